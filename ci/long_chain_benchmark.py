@@ -0,0 +1,89 @@
+"""
+Compile-time/binary-size benchmark for long chains of operators.
+
+Builds src/examples/rpp/long_chain and synthetic chain of 30 operators with different values of RPP_TYPE_ERASURE_CHAIN_THRESHOLD and
+reports compilation time, size of binary and size of symbols. Output of each binary is compared with output of the build without type-erasure.
+
+Usage: python3 ci/long_chain_benchmark.py [--compiler g++] [--thresholds 0 4 8] [--flags="-O2"]
+"""
+
+import argparse
+import os
+import subprocess
+import tempfile
+import time
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+LONG_CHAIN = os.path.join(ROOT, "src", "examples", "rpp", "long_chain", "long_chain.cpp")
+
+OPERATORS = [
+    "rpp::operators::map([](int v) {{ return v + {i}; }})",
+    "rpp::operators::filter([](int v) {{ return v % 7 != {i} % 7; }})",
+    "rpp::operators::distinct_until_changed()",
+    "rpp::operators::scan([](int s, int v) {{ return (s + v) % 1000 + {i}; }})",
+    "rpp::operators::skip(0)",
+    "rpp::operators::take_while([](int v) {{ return v >= 0; }})",
+]
+
+
+def generate_synthetic_chain(length):
+    ops = "\n".join(f"        | {OPERATORS[i % len(OPERATORS)].format(i=i)}" for i in range(length))
+    return f"""#include <rpp/rpp.hpp>
+
+#include <iostream>
+
+int main() // NOLINT(bugprone-exception-escape)
+{{
+    rpp::source::from_iterable(std::vector<int>{{1, 2, 3, 4, 5, 6, 7, 8, 9, 10}})
+{ops}
+        | rpp::operators::subscribe([](int v) {{ std::cout << v << ' '; }});
+    return 0;
+}}
+"""
+
+
+def symbols_stats(binary):
+    out = subprocess.run(["nm", binary], capture_output=True, text=True, check=True).stdout
+    names = [line.split()[-1] for line in out.splitlines() if line.strip() and "rpp" in line]
+    return len(names), sum(len(n) for n in names), max((len(n) for n in names), default=0)
+
+
+def build(compiler, flags, source, threshold, output):
+    cmd = [compiler, "-std=c++20", *flags, f"-DRPP_TYPE_ERASURE_CHAIN_THRESHOLD={threshold}", "-I", os.path.join(ROOT, "src", "rpp"), source, "-o", output, "-pthread"]
+    start = time.perf_counter()
+    subprocess.run(cmd, check=True)
+    return time.perf_counter() - start
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--compiler", default="g++")
+    parser.add_argument("--thresholds", nargs="+", type=int, default=[0, 4, 8])
+    parser.add_argument("--flags", default="-O2")
+    parser.add_argument("--length", type=int, default=30, help="amount of operators in synthetic chain")
+    args = parser.parse_args()
+
+    with tempfile.TemporaryDirectory() as tmp:
+        synthetic = os.path.join(tmp, "synthetic_chain.cpp")
+        with open(synthetic, "w") as f:
+            f.write(generate_synthetic_chain(args.length))
+
+        print("| source | threshold | compile time (s) | binary size (bytes) | rpp symbols | total length of rpp symbols | longest rpp symbol |")
+        print("|---|---|---|---|---|---|---|")
+        for name, source in (("long_chain", LONG_CHAIN), (f"synthetic chain of {args.length}", synthetic)):
+            expected = None
+            for threshold in args.thresholds:
+                binary = os.path.join(tmp, f"chain_{threshold}")
+                elapsed = build(args.compiler, args.flags.split(), source, threshold, binary)
+                output = subprocess.run([binary], capture_output=True, text=True, check=True).stdout
+                if expected is None:
+                    expected = output
+                elif output != expected:
+                    raise RuntimeError(f"{name}: output with threshold {threshold} differs from output with threshold {args.thresholds[0]}")
+
+                count, total, longest = symbols_stats(binary)
+                print(f"| {name} | {threshold} | {elapsed:.2f} | {os.path.getsize(binary)} | {count} | {total} | {longest} |")
+
+
+if __name__ == "__main__":
+    main()
@@ -44,6 +44,8 @@ endif()
 # ------------ Options to tweak ---------------------
 option(RPP_BUILD_SFML_CODE "Enable SFML support in examples/code." OFF)
 option(RPP_BUILD_QT_CODE "Enable QT support in examples/code." OFF)
+option(RPP_PAD_SHARED_STATES "Place fields of operators' states written by different threads in separate cache lines." ON)
+set(RPP_TYPE_ERASURE_CHAIN_THRESHOLD 0 CACHE STRING "Convert chain of operators to rpp::dynamic_observable every N operators to shorten symbols (0 - disabled). Does not reduce compilation time.")
 
 if (RPP_DEVELOPER_MODE)
   option(RPP_BUILD_TESTS      "Build unit tests tree." OFF)
@@ -2,16 +2,23 @@
 
 #include <rpp/rpp.hpp>
 
+#include <atomic>
 #include <fstream>
 #include <functional>
 #include <iostream>
 #include <map>
 #include <span>
 #include <string_view>
+#include <thread>
 #include <tuple>
 #ifdef RPP_BUILD_RXCPP
     #include <rxcpp/rx.hpp>
 #endif
+#ifdef RPP_BUILD_QT_CODE
+    #include <rppqt/schedulers.hpp>
+
+    #include <QCoreApplication>
+#endif
 
 #define BENCHMARK(NAME)                     \
     bench.context("benchmark_title", NAME); \
@@ -64,6 +71,62 @@ namespace rpp
     }
 } // namespace rpp
 
+namespace
+{
+    auto make_sink_observer()
+    {
+        return rpp::make_lambda_observer([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+    }
+
+    // hot path of inner observers of merge emitting from 2 threads, applied to state of merge directly to compare padded and unpadded layouts of it
+    template<bool Padded>
+    void merge_state_from_two_threads()
+    {
+        using state_t    = rpp::operators::details::merge_disposable<decltype(make_sink_observer()), Padded>;
+        const auto state = rpp::disposable_wrapper_impl<state_t>::make(make_sink_observer()).lock();
+
+        const auto emit = [&state] {
+            for (int v = 0; v < 10000; ++v)
+            {
+                if (state->is_disposed())
+                    return;
+
+                state->consume_demand({});
+                state->get_observer_under_lock()->on_next(v);
+            }
+        };
+
+        std::thread other{emit};
+        emit();
+        other.join();
+    }
+
+    // outer observable of concat pushes observables to queue while inner one emits from other thread, applied to state of concat directly to compare padded and unpadded layouts of it
+    template<bool Padded>
+    void concat_state_from_two_threads()
+    {
+        using observable_t = rpp::dynamic_observable<int>;
+        using state_t      = rpp::operators::details::concat_state_t<observable_t, decltype(make_sink_observer()), Padded>;
+        const auto state   = rpp::disposable_wrapper_impl<state_t>::make(make_sink_observer()).lock();
+        const auto inner   = rpp::source::never<int>().as_dynamic();
+
+        state->stage().store(rpp::operators::details::ConcatStage::Processing, std::memory_order::relaxed);
+        std::thread other{[&state] {
+            for (int v = 0; v < 10000; ++v)
+            {
+                if (state->stage().load(std::memory_order::relaxed) == rpp::operators::details::ConcatStage::None)
+                    return;
+
+                state->consume_demand();
+                state->get_observer()->on_next(v);
+            }
+        }};
+        for (int v = 0; v < 10000; ++v)
+            state->get_queue()->push(inner);
+        other.join();
+    }
+} // namespace
+
 namespace rxcpp
 {
     template<typename... Ts>
@@ -118,8 +181,75 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
                     | rxcpp::operators::subscribe<int>([](int) {});
             });
         }
+
+        SECTION("Subscribe to immediate_just(1) + map + filter (allocation-free chain)")
+        {
+            TEST_RPP([&]() {
+                rpp::immediate_just(1)
+                    | rpp::operators::map([](int v) { return v * 2; })
+                    | rpp::operators::filter([](int v) { return v > 0; })
+                    | rpp::operators::subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+
+            TEST_RXCPP([&]() {
+                rxcpp::immediate_just(1)
+                    | rxcpp::operators::map([](int v) { return v * 2; })
+                    | rxcpp::operators::filter([](int v) { return v > 0; })
+                    | rxcpp::operators::subscribe<int>([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+        }
     }; // BENCHMARK("General")
 
+    BENCHMARK("Disposables")
+    {
+        const auto make_wide_tree = [](size_t count) {
+            auto root = rpp::composite_disposable_wrapper::make();
+            for (size_t i = 0; i < count; ++i)
+                root.add(rpp::composite_disposable_wrapper::make());
+            return root;
+        };
+
+        const auto make_deep_chain = [](size_t count) {
+            auto root = rpp::composite_disposable_wrapper::make();
+            auto last = root;
+            for (size_t i = 0; i < count; ++i)
+            {
+                auto next = rpp::composite_disposable_wrapper::make();
+                last.add(next);
+                last = std::move(next);
+            }
+            return root;
+        };
+
+        SECTION("create + dispose wide tree of 100'000 composite_disposables")
+        {
+            TEST_RPP([&]() {
+                make_wide_tree(100'000).dispose();
+            });
+        }
+
+        SECTION("create + dispose wide tree of 1'000'000 composite_disposables")
+        {
+            TEST_RPP([&]() {
+                make_wide_tree(1'000'000).dispose();
+            });
+        }
+
+        SECTION("create + dispose deep chain of 100'000 composite_disposables")
+        {
+            TEST_RPP([&]() {
+                make_deep_chain(100'000).dispose();
+            });
+        }
+
+        SECTION("create + dispose deep chain of 1'000'000 composite_disposables")
+        {
+            TEST_RPP([&]() {
+                make_deep_chain(1'000'000).dispose();
+            });
+        }
+    } // BENCHMARK("Disposables")
+
     BENCHMARK("Sources")
     {
         SECTION("from array of 1 - create + subscribe + immediate")
@@ -325,6 +455,64 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
                     | rxcpp::operators::subscribe<std::tuple<int, int>>([](auto&& v) { ankerl::nanobench::doNotOptimizeAway(v); });
             });
         }
+
+        SECTION("publish_subject x2 + join_within(1s, 1024 per side) + subscribe - on_next for each side")
+        {
+            rpp::subjects::publish_subject<int> left{};
+            rpp::subjects::publish_subject<int> right{};
+            left.get_observable()
+                | rpp::operators::join_within(right.get_observable(), std::identity{}, std::identity{}, std::chrono::seconds{1}, std::plus<int>{}, rpp::schedulers::new_thread{}, 1024)
+                | rpp::operators::subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+
+            int i{};
+            TEST_RPP([&]() {
+                left.get_observer().on_next(i % 4096);
+                right.get_observer().on_next(i % 4096);
+                ++i;
+            });
+
+            left.get_observer().on_completed();
+            right.get_observer().on_completed();
+        }
+
+        SECTION("publish_subject x2 + merge_with + subscribe - 10'000 on_next from each of 2 threads")
+        {
+            rpp::subjects::publish_subject<int> left{};
+            rpp::subjects::publish_subject<int> right{};
+            left.get_observable()
+                | rpp::operators::merge_with(right.get_observable())
+                | rpp::operators::subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+
+            TEST_RPP([&]() {
+                std::thread other{[&] {
+                    for (int v = 0; v < 10000; ++v)
+                        right.get_observer().on_next(v);
+                }};
+                for (int v = 0; v < 10000; ++v)
+                    left.get_observer().on_next(v);
+                other.join();
+            });
+        }
+
+        SECTION("merge state (padded layout) - 10'000 on_next from each of 2 threads")
+        {
+            TEST_RPP([&]() { merge_state_from_two_threads<true>(); });
+        }
+
+        SECTION("merge state (unpadded layout) - 10'000 on_next from each of 2 threads")
+        {
+            TEST_RPP([&]() { merge_state_from_two_threads<false>(); });
+        }
+
+        SECTION("concat state (padded layout) - 10'000 pushes to queue + 10'000 on_next from other thread")
+        {
+            TEST_RPP([&]() { concat_state_from_two_threads<true>(); });
+        }
+
+        SECTION("concat state (unpadded layout) - 10'000 pushes to queue + 10'000 on_next from other thread")
+        {
+            TEST_RPP([&]() { concat_state_from_two_threads<false>(); });
+        }
     } // BENCHMARK("Combining Operators")
 
     BENCHMARK("Conditional Operators")
@@ -543,6 +731,43 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
                     | rxcpp::operators::subscribe<int>([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
             });
         }
+
+        SECTION("immediate_just+rate_limit(drop, within budget)+subscribe")
+        {
+            TEST_RPP([&]() {
+                rpp::immediate_just(1)
+                    | rpp::operators::rate_limit(std::chrono::seconds{1}, 1, rpp::schedulers::immediate{}, rpp::operators::rate_limit_policy::drop{})
+                    | rpp::operators::subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+        }
+
+        SECTION("publish_subject+rate_limit(delay, within budget)+subscribe - on_next")
+        {
+            rpp::subjects::publish_subject<int> subj{};
+            subj.get_observable()
+                | rpp::operators::rate_limit(std::chrono::nanoseconds{1}, 1024, rpp::schedulers::new_thread{}, rpp::operators::rate_limit_policy::delay{1024})
+                | rpp::operators::subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+
+            TEST_RPP([&]() {
+                subj.get_observer().on_next(1);
+            });
+
+            subj.get_observer().on_completed();
+        }
+
+        SECTION("publish_subject+sample(1s)+subscribe - on_next")
+        {
+            rpp::subjects::publish_subject<int> subj{};
+            subj.get_observable()
+                | rpp::operators::sample(std::chrono::seconds{1}, rpp::schedulers::new_thread{})
+                | rpp::operators::subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+
+            TEST_RPP([&]() {
+                subj.get_observer().on_next(1);
+            });
+
+            subj.get_observer().on_completed();
+        }
     }; // BENCHMARK("Filtering Operators")
 
     BENCHMARK("Utility Operators")
@@ -561,6 +786,29 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
                     | rxcpp::operators::subscribe<int>([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
             });
         }
+
+        SECTION("publish_subject+delay(0, new_thread)+subscribe - 10'000 on_next + wait")
+        {
+            rpp::subjects::publish_subject<int> subj{};
+            std::atomic_size_t                  count{};
+            subj.get_observable()
+                | rpp::operators::delay(std::chrono::nanoseconds{0}, rpp::schedulers::new_thread{})
+                | rpp::operators::subscribe([&count](int v) {
+                      ankerl::nanobench::doNotOptimizeAway(v);
+                      count.fetch_add(1, std::memory_order::relaxed);
+                  });
+
+            size_t expected{};
+            TEST_RPP([&]() {
+                for (int v = 0; v < 10000; ++v)
+                    subj.get_observer().on_next(v);
+                expected += 10000;
+                while (count.load(std::memory_order::relaxed) != expected)
+                    std::this_thread::yield();
+            });
+
+            subj.get_observer().on_completed();
+        }
     } // BENCHMARK("Utility Operators")
 
     BENCHMARK("Aggregating Operators")
@@ -624,8 +872,83 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
                 });
             }
         }
+
+        SECTION("publish_subject+observe_on(run_loop) with 3 observers - 512 on_next + dispatch")
+        {
+            rpp::schedulers::run_loop           loop{};
+            rpp::subjects::publish_subject<int> rpp_subj{};
+            for (size_t i = 0; i < 3; ++i)
+                rpp_subj.get_observable() | rpp::operators::observe_on(loop) | rpp::operators::subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+            TEST_RPP([&]() {
+                for (int v = 0; v < 512; ++v)
+                    rpp_subj.get_observer().on_next(v);
+                while (!loop.is_empty())
+                    loop.dispatch();
+            });
+        }
+
+        SECTION("broadcast_subject(512, run_loop) with 3 observers - 512 on_next + dispatch")
+        {
+            rpp::schedulers::run_loop                                        loop{};
+            rpp::subjects::broadcast_subject<int, rpp::schedulers::run_loop> rpp_subj{512, loop};
+            for (size_t i = 0; i < 3; ++i)
+                rpp_subj.get_observable().subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+            TEST_RPP([&]() {
+                for (int v = 0; v < 512; ++v)
+                    rpp_subj.get_observer().on_next(v);
+                while (!loop.is_empty())
+                    loop.dispatch();
+            });
+        }
+
+        SECTION("publish_subject+filter by key with 1000 observers - on_next")
+        {
+            rpp::subjects::publish_subject<std::pair<int, int>> rpp_subj{};
+            for (int key = 0; key < 1000; ++key)
+                rpp_subj.get_observable() | rpp::operators::filter([key](const std::pair<int, int>& v) { return v.first == key; }) | rpp::operators::subscribe([](const std::pair<int, int>& v) { ankerl::nanobench::doNotOptimizeAway(v); });
+            TEST_RPP([&]() {
+                rpp_subj.get_observer().on_next({1, 1});
+            });
+        }
+
+        SECTION("keyed_subject with 1000 observers of different keys - on_next")
+        {
+            rpp::subjects::keyed_subject<int, int> rpp_subj{};
+            for (int key = 0; key < 1000; ++key)
+                rpp_subj.get_observable(key).subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+            TEST_RPP([&]() {
+                rpp_subj.get_observer().on_next({1, 1});
+            });
+        }
     } // BENCHMARK("Subjects")
 
+#ifdef RPP_BUILD_QT_CODE
+    BENCHMARK("Qt")
+    {
+        // offscreen platform: benchmark doesn't need any display
+        qputenv("QT_QPA_PLATFORM", "offscreen");
+        int              qt_argc{};
+        QCoreApplication application{qt_argc, nullptr};
+
+        SECTION("observe_on(main_thread_scheduler) - 10k on_next + processEvents")
+        {
+            rpp::subjects::publish_subject<int> rpp_subj{};
+            size_t                              count{};
+            rpp_subj.get_observable() | rpp::operators::observe_on(rppqt::schedulers::main_thread_scheduler{}) | rpp::operators::subscribe([&count](int v) {
+                ankerl::nanobench::doNotOptimizeAway(v);
+                ++count;
+            });
+            TEST_RPP([&]() {
+                count = 0;
+                for (int v = 0; v < 10000; ++v)
+                    rpp_subj.get_observer().on_next(v);
+                while (count != 10000)
+                    QCoreApplication::processEvents();
+            });
+        }
+    } // BENCHMARK("Qt")
+#endif
+
     BENCHMARK("Scenarios")
     {
         SECTION("basic sample")
@@ -36,4 +36,20 @@ int main() // NOLINT(bugprone-exception-escape)
     //    emit 3 duration since start 25ms
     //    On complete
     //! [defer from_iterable]
-}
\ No newline at end of file
+
+    //! [ticker]
+    const auto ticker = rpp::source::ticker<rpp::schedulers::new_thread>{};
+    ticker.interval(std::chrono::milliseconds(10))
+        | rpp::operators::take(3)
+        | rpp::operators::merge_with(ticker.interval(std::chrono::milliseconds(10)) | rpp::operators::take(2))
+        | rpp::operators::as_blocking()
+        | rpp::operators::subscribe([](size_t v) { std::cout << "emit " << v << '\n'; });
+    // Both intervals are served by one timer on one thread
+    // Output:
+    //    emit 0
+    //    emit 0
+    //    emit 1
+    //    emit 1
+    //    emit 2
+    //! [ticker]
+}
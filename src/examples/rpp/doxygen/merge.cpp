@@ -22,5 +22,24 @@ int main()
         | rpp::operators::subscribe([](int v) { std::cout << v << " "; });
     // Output: 1 2
     //! [merge_with]
+
+    //! [merge_with_priority]
+    auto bulk    = rpp::subjects::publish_subject<int>{};
+    auto control = rpp::subjects::publish_subject<int>{};
+    bulk.get_observable()
+        | rpp::operators::merge_with_priority(0, 16, rpp::operators::with_priority(control.get_observable(), 1))
+        | rpp::operators::subscribe([&](int v) {
+              std::cout << v << " ";
+              if (v == 1)
+              {
+                  // emissions arrived while 1 is being emitted are staged and drained according to priority
+                  bulk.get_observer().on_next(2);
+                  bulk.get_observer().on_next(3);
+                  control.get_observer().on_next(100);
+              }
+          });
+    bulk.get_observer().on_next(1);
+    // Output: 1 100 2 3
+    //! [merge_with_priority]
     return 0;
 }
@@ -3,6 +3,7 @@
 #include <rppqt/rppqt.hpp>
 
 #include <QApplication>
+#include <QSlider>
 #include <QTextEdit>
 #include <iostream>
 
@@ -31,5 +32,21 @@ int main(int argc, char* argv[])
     // text_edit destroyed!
     //! [from_signal]
 
+    //! [from_signal_coalesced]
+    // value is carried by signal itself: values are emitted asynchronously, so, object is not accessed from observer
+    QSlider* slider = new QSlider();
+    rppqt::source::from_signal_coalesced(*slider, &QSlider::valueChanged)
+        | rpp::ops::subscribe([](int value) { std::cout << "value changed: " << value << std::endl; },
+                              []() { std::cout << "slider destroyed!" << std::endl; });
+    slider->setValue(10);
+    slider->setValue(42);
+    QApplication::processEvents();
+    slider->setValue(50);
+    delete slider;
+    // Output:
+    // value changed: 42
+    // slider destroyed!
+    //! [from_signal_coalesced]
+
     return 0;
 }
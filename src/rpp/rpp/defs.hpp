@@ -21,4 +21,19 @@
     #define RPP_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
 #else
     #define RPP_NO_UNIQUE_ADDRESS [[no_unique_address]]
-#endif
\ No newline at end of file
+#endif
+
+// Each operator in chain wraps observer of next one, so, long chains of operators produce deeply nested types: huge symbols and debug binaries.
+// If defined to non-zero N, chain of operators is converted to rpp::dynamic_observable (type-erased) every N operators automatically, so, nesting of types is limited by N operators.
+// It is a knob for size of symbols and unoptimized (debug) binaries only: it does NOT reduce compilation time, and optimized binaries usually become bigger due to type-erased chains can't be inlined.
+// Cost of each such boundary is 1 heap allocation per subscription and 1 virtual call per emission. Disabled by default.
+// Changes types of observables, so, it MUST be the same for whole program (all translation units and libraries using rpp): otherwise the same inline functions/templates are compiled differently in different translation units (ODR violation). Prefer CMake option RPP_TYPE_ERASURE_CHAIN_THRESHOLD instead of defining it manually.
+#ifndef RPP_TYPE_ERASURE_CHAIN_THRESHOLD
+    #define RPP_TYPE_ERASURE_CHAIN_THRESHOLD 0
+#endif
+
+// States of operators like merge/concat are touched by different threads. If non-zero, their fields written by different threads are placed in separate cache lines to avoid false sharing (costs a few cache lines of memory per subscription). Enabled by default.
+// Changes layout of states, so, it MUST be the same for whole program: prefer CMake option RPP_PAD_SHARED_STATES instead of defining it manually.
+#ifndef RPP_PAD_SHARED_STATES
+    #define RPP_PAD_SHARED_STATES 1
+#endif
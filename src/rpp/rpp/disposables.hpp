@@ -21,6 +21,7 @@
 
 #include <rpp/disposables/callback_disposable.hpp>
 #include <rpp/disposables/composite_disposable.hpp>
+#include <rpp/disposables/demand_disposable.hpp>
 #include <rpp/disposables/disposable_wrapper.hpp>
 #include <rpp/disposables/interface_disposable.hpp>
 #include <rpp/disposables/refcount_disposable.hpp>
@@ -23,6 +23,7 @@ namespace rpp
     /**
      * @brief Disposable which can keep some other sub-disposables. When this root disposable is disposed, then all sub-disposables would be disposed too.
      * @tparam Container is type of internal storage used to keep dependencies
+     * @warning Sub-disposables are disposed without recursion: if `dispose()` is called while another disposable is being disposed on the same thread (for example, this one is sub-disposable of it), `dispose()` returns before sub-disposables are disposed. They are disposed right after it, before outermost `dispose()` returns.
      *
      * @ingroup disposables
      */
@@ -168,6 +169,7 @@ namespace rpp
     /**
      * @brief Disposable which can keep some other sub-disposables. When this root disposable is disposed, then all sub-disposables would be disposed too.
      * @note By default uses vector as internal storage
+     * @warning Sub-disposables are disposed without recursion: if `dispose()` is called while another disposable is being disposed on the same thread (for example, this one is sub-disposable of it), `dispose()` returns before sub-disposables are disposed. They are disposed right after it, before outermost `dispose()` returns.
      *
      * @ingroup disposables
      */
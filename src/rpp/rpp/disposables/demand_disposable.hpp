@@ -0,0 +1,331 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/disposables/fwd.hpp>
+
+#include <rpp/disposables/composite_disposable.hpp>
+#include <rpp/disposables/disposable_wrapper.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace rpp
+{
+    /**
+     * @brief Interface of disposable which is able to emit items on demand (`request(n)` backpressure protocol).
+     * @details Demand-aware consumer obtains it from disposable passed to `set_upstream` and switches upstream into bounded mode via `limit_demand` before any emission. After that upstream emits no more items than were requested in total, while consumer calls `request(n)` each time it is ready to accept more items.
+     * @details Upstreams which were never switched into bounded mode behave as usual: emit items as fast as possible.
+     *
+     * @ingroup disposables
+     */
+    struct interface_demand
+    {
+        static constexpr size_t unbounded = std::numeric_limits<size_t>::max();
+
+        virtual ~interface_demand() noexcept = default;
+
+        /**
+         * @brief Switch upstream into bounded mode with `initial` amount of requested items
+         * @warning Expected to be called during subscription before any emission
+         */
+        virtual void limit_demand(size_t initial) noexcept = 0;
+
+        /**
+         * @brief Request `n` more items from upstream
+         * @warning This function must be thread-safe
+         */
+        virtual void request(size_t n) noexcept = 0;
+    };
+} // namespace rpp
+
+namespace rpp::details
+{
+    /**
+     * @brief Lock-free counter of requested items.
+     * @details Producer marks itself as suspended when there is no demand, requester resumes it if it was suspended. Both sides check other's flag after publishing own one, so, exactly one of them continues emission.
+     */
+    class demand_counter
+    {
+    public:
+        void limit(size_t initial) { m_demand.store(std::min(initial, interface_demand::unbounded - 1), std::memory_order::seq_cst); }
+
+        size_t get() const { return m_demand.load(std::memory_order::seq_cst); }
+
+        /**
+         * @brief Adds `n` to demand
+         * @return true if producer was suspended and requester has to resume it
+         */
+        bool add(size_t n)
+        {
+            auto current = m_demand.load(std::memory_order::seq_cst);
+            while (current != interface_demand::unbounded && !m_demand.compare_exchange_strong(current, current + std::min(n, interface_demand::unbounded - 1 - current), std::memory_order::seq_cst))
+            {
+            }
+            return m_suspended.exchange(false, std::memory_order::seq_cst);
+        }
+
+        bool try_acquire()
+        {
+            auto current = m_demand.load(std::memory_order::seq_cst);
+            while (current != 0)
+            {
+                if (current == interface_demand::unbounded || m_demand.compare_exchange_strong(current, current - 1, std::memory_order::seq_cst))
+                    return true;
+            }
+            return false;
+        }
+
+        /**
+         * @brief Acquires one item of demand. In case of no demand marks producer as suspended
+         * @return false if producer is suspended and would be resumed on next request
+         */
+        bool try_acquire_or_suspend()
+        {
+            while (!try_acquire())
+            {
+                m_suspended.store(true, std::memory_order::seq_cst);
+                if (m_demand.load(std::memory_order::seq_cst) == 0)
+                    return false;
+
+                // demand was added concurrently. If requester already took responsibility to resume us, then let it do it
+                if (!m_suspended.exchange(false, std::memory_order::seq_cst))
+                    return false;
+            }
+            return true;
+        }
+
+    private:
+        std::atomic_size_t m_demand{interface_demand::unbounded};
+        std::atomic_bool   m_suspended{};
+    };
+
+    /**
+     * @brief Keeps demand of downstream and forwards it to the only currently active demand-aware inner source of operator.
+     * @details Newly subscribed inner source obtains currently outstanding demand of downstream as initial one.
+     */
+    class demand_forwarder
+    {
+    public:
+        void limit(size_t initial) { m_demand.limit(initial); }
+
+        bool is_limited() const { return m_demand.get() != interface_demand::unbounded; }
+
+        void consume() { m_demand.try_acquire(); }
+
+        /**
+         * @brief Forward demand only to this inner source
+         */
+        void set_inner(const std::shared_ptr<interface_demand>& inner)
+        {
+            std::lock_guard lock{m_mutex};
+            inner->limit_demand(m_demand.get());
+            m_inner = inner;
+        }
+
+        void request(size_t n)
+        {
+            std::shared_ptr<interface_demand> inner{};
+            {
+                std::lock_guard lock{m_mutex};
+                m_demand.add(n);
+                inner = m_inner.lock();
+            }
+            // inner is requested out of lock due to it can emit (and request more) right during this call
+            if (inner)
+                inner->request(n);
+        }
+
+    private:
+        std::mutex                      m_mutex{};
+        std::weak_ptr<interface_demand> m_inner{};
+        demand_counter                  m_demand{};
+    };
+
+    /**
+     * @brief Keeps demand of downstream and shares it between multiple demand-aware inner sources of operator.
+     * @details Inner sources obtain outstanding demand of downstream one item at a time in round-robin order: inner source is requested for next item only after previous one was delivered. As a result, total amount of items in flight never exceeds amount of items requested by downstream. Demand granted to inner source but not used by it is returned back when it completes.
+     */
+    class demand_distributor
+    {
+    public:
+        struct inner
+        {
+            std::weak_ptr<interface_demand> demand;
+            size_t                          granted{};
+        };
+
+        using inner_ptr = std::shared_ptr<inner>;
+
+        void limit(size_t initial)
+        {
+            std::lock_guard lock{m_mutex};
+            m_outstanding = initial;
+            m_is_limited.store(true, std::memory_order::seq_cst);
+        }
+
+        bool is_limited() const { return m_is_limited.load(std::memory_order::seq_cst); }
+
+        inner_ptr add_inner(const std::shared_ptr<interface_demand>& demand)
+        {
+            demand->limit_demand(0);
+
+            auto             result = std::make_shared<inner>(inner{demand});
+            std::unique_lock lock{m_mutex};
+            m_starving.push_back(result);
+            distribute(std::move(lock));
+            return result;
+        }
+
+        /**
+         * @brief Item was delivered to downstream from inner source (or from demand-unaware source in case of nullptr)
+         */
+        void consume(const inner_ptr& from)
+        {
+            std::unique_lock lock{m_mutex};
+            if (!from || from->granted == 0)
+            {
+                if (m_outstanding != 0)
+                    --m_outstanding;
+                return;
+            }
+
+            if (--from->granted != 0)
+                return;
+
+            m_starving.push_back(from);
+            distribute(std::move(lock));
+        }
+
+        void remove_inner(const inner_ptr& from)
+        {
+            std::unique_lock lock{m_mutex};
+            m_outstanding += std::exchange(from->granted, 0);
+            std::erase(m_starving, from);
+            distribute(std::move(lock));
+        }
+
+        void request(size_t n)
+        {
+            std::unique_lock lock{m_mutex};
+            m_outstanding += std::min(n, interface_demand::unbounded - m_outstanding);
+            distribute(std::move(lock));
+        }
+
+    private:
+        void distribute(std::unique_lock<std::mutex> lock)
+        {
+            while (m_outstanding != 0 && !m_starving.empty())
+            {
+                const auto next = std::move(m_starving.front());
+                m_starving.pop_front();
+
+                const auto demand = next->demand.lock();
+                if (!demand)
+                    continue;
+
+                --m_outstanding;
+                next->granted = 1;
+
+                // inner is requested out of lock due to it can emit (and consume/request more) right during this call
+                lock.unlock();
+                demand->request(1);
+                lock.lock();
+            }
+        }
+
+    private:
+        std::mutex            m_mutex{};
+        std::deque<inner_ptr> m_starving{};
+        size_t                m_outstanding{};
+        std::atomic_bool      m_is_limited{};
+    };
+
+    inline std::shared_ptr<interface_demand> get_demand(const rpp::disposable_wrapper& disposable)
+    {
+        return std::dynamic_pointer_cast<interface_demand>(disposable.lock());
+    }
+
+    /**
+     * @brief Forwards disposing to upstream's disposable but doesn't expose its demand.
+     */
+    class demand_hiding_disposable final : public interface_disposable
+    {
+    public:
+        explicit demand_hiding_disposable(rpp::disposable_wrapper upstream)
+            : m_upstream{std::move(upstream)}
+        {
+        }
+
+        bool is_disposed() const noexcept override { return m_upstream.is_disposed(); }
+
+    private:
+        void dispose_impl(Mode mode) noexcept override
+        {
+            if (mode == Mode::Disposing)
+                m_upstream.dispose();
+        }
+
+        rpp::disposable_wrapper m_upstream;
+    };
+
+    /**
+     * @brief Hides demand of upstream from downstream. Used by operators which don't emit exactly one item per each received one (like `filter` or `reduce`): otherwise downstream would request items which would never be delivered to it and wait for them forever.
+     * @details Such an upstream is treated by downstream as usual one, so, it emits items as fast as possible.
+     */
+    inline rpp::disposable_wrapper hide_demand(const rpp::disposable_wrapper& disposable)
+    {
+        if (!get_demand(disposable))
+            return disposable;
+        return rpp::disposable_wrapper::make<demand_hiding_disposable>(disposable);
+    }
+} // namespace rpp::details
+
+namespace rpp
+{
+    /**
+     * @brief Disposable which keeps counter of items requested by downstream. Base for sources which are able to emit items on demand.
+     * @details Source emits items only after successful `try_acquire_demand_or_suspend()`. If there is no demand, source stops emissions and waits for `on_demand_available()` call.
+     *
+     * @ingroup disposables
+     */
+    class demand_disposable : public composite_disposable
+        , public interface_demand
+    {
+    public:
+        void limit_demand(size_t initial) noexcept override { m_demand.limit(initial); }
+
+        void request(size_t n) noexcept override
+        {
+            if (m_demand.add(n))
+                on_demand_available();
+        }
+
+    protected:
+        /**
+         * @brief Acquires one requested item. In case of no demand source is treated as suspended and `on_demand_available` would be invoked on next request.
+         */
+        bool try_acquire_demand_or_suspend() noexcept { return m_demand.try_acquire_or_suspend(); }
+
+        /**
+         * @brief Invoked from `request` when source was suspended due to lack of demand. Invoked from thread of requester.
+         */
+        virtual void on_demand_available() noexcept = 0;
+
+    private:
+        details::demand_counter m_demand{};
+    };
+} // namespace rpp
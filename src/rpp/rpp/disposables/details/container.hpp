@@ -13,10 +13,55 @@
 #include <rpp/utils/exceptions.hpp>
 
 #include <algorithm>
+#include <iterator>
 #include <vector>
 
 namespace rpp::details::disposables
 {
+    inline thread_local std::vector<rpp::disposable_wrapper>* s_pending_disposables{};
+
+    /**
+     * @brief Disposes range of disposables without recursion.
+     * @details Disposing of some disposable can lead to disposing of its own sub-disposables and so on, so, deep trees (or long chains) of disposables would lead to deep recursion and stack overflow.
+     * To prevent it, nested call (happening while another one is in progress on the same thread) just defers disposables into thread-local work-list. This work-list is drained by outermost call in the same depth-first order as recursion would do.
+     * @warning As a result, nested call returns before its disposables are disposed: they are disposed before outermost call returns.
+     */
+    template<std::bidirectional_iterator It>
+    void dispose_range(It begin, It end) noexcept
+    {
+        if (s_pending_disposables)
+        {
+            try
+            {
+                // reversed to keep original order during popping from the back
+                s_pending_disposables->insert(s_pending_disposables->end(), std::make_reverse_iterator(end), std::make_reverse_iterator(begin));
+                return;
+            }
+            catch (...)
+            {
+                // insertion at the end has no effect in case of failure: fall back to recursive disposing
+            }
+
+            for (; begin != end; ++begin)
+                begin->dispose();
+            return;
+        }
+
+        std::vector<rpp::disposable_wrapper> pending{};
+        s_pending_disposables = &pending;
+        for (; begin != end; ++begin)
+        {
+            begin->dispose();
+            while (!pending.empty())
+            {
+                const auto d = std::move(pending.back());
+                pending.pop_back();
+                d.dispose();
+            }
+        }
+        s_pending_disposables = nullptr;
+    }
+
     class dynamic_disposables_container_base
     {
     public:
@@ -42,10 +87,7 @@ namespace rpp::details::disposables
 
         void dispose() const
         {
-            for (auto& d : m_data)
-            {
-                d.dispose();
-            }
+            dispose_range(m_data.cbegin(), m_data.cend());
         }
 
         void clear()
@@ -131,10 +173,7 @@ namespace rpp::details::disposables
 
         void dispose() const
         {
-            for (size_t i = 0; i < m_size; ++i)
-            {
-                get(i)->dispose();
-            }
+            dispose_range(get(0), get(0) + m_size);
         }
 
         void clear()
@@ -71,6 +71,10 @@ namespace rpp
 
     class refcount_disposable;
 
+    struct interface_demand;
+
+    class demand_disposable;
+
     template<rpp::constraint::is_nothrow_invocable Fn>
     disposable_wrapper make_callback_disposable(Fn&& invocable);
 } // namespace rpp
\ No newline at end of file
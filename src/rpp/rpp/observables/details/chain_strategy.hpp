@@ -89,4 +89,16 @@ namespace rpp
 
     template<typename New, typename Old>
     using make_chain_observable_t = typename make_chain_observable<New, Old>::type;
-} // namespace rpp
\ No newline at end of file
+} // namespace rpp
+
+namespace rpp::details::observables
+{
+    /**
+     * @brief Amount of operators in chain of observable's strategy
+     */
+    template<typename Strategy>
+    inline constexpr size_t chain_length_v = 0;
+
+    template<typename... Strategies>
+    inline constexpr size_t chain_length_v<observable_chain_strategy<Strategies...>> = sizeof...(Strategies) - 1;
+} // namespace rpp::details::observables
\ No newline at end of file
@@ -366,16 +366,33 @@ namespace rpp
         template<constraint::operator_chain<Type, expected_disposable_strategy> Op>
         auto inner_make_chain_operator(Op&& op) const &
         {
-            return observable<typename std::decay_t<Op>::template operator_traits<Type>::result_type, make_chain_observable_t<std::decay_t<Op>, Strategy>>{std::forward<Op>(op), m_strategy};
+            return limit_chain_length(observable<typename std::decay_t<Op>::template operator_traits<Type>::result_type, make_chain_observable_t<std::decay_t<Op>, Strategy>>{std::forward<Op>(op), m_strategy});
         }
 
         template<constraint::operator_chain<Type, expected_disposable_strategy> Op>
         auto inner_make_chain_operator(Op&& op) &&
         {
-            return observable<typename std::decay_t<Op>::template operator_traits<Type>::result_type, make_chain_observable_t<std::decay_t<Op>, Strategy>>{std::forward<Op>(op), std::move(m_strategy)};
+            return limit_chain_length(observable<typename std::decay_t<Op>::template operator_traits<Type>::result_type, make_chain_observable_t<std::decay_t<Op>, Strategy>>{std::forward<Op>(op), std::move(m_strategy)});
+        }
+
+        /**
+         * @brief Converts observable to type-erased one if its chain reached RPP_TYPE_ERASURE_CHAIN_THRESHOLD operators, so, next operators start new chain (and new nesting of observers) from rpp::dynamic_observable
+         */
+        template<constraint::decayed_type TType, typename TStrategy>
+        static auto limit_chain_length(observable<TType, TStrategy>&& chain)
+        {
+            if constexpr (RPP_TYPE_ERASURE_CHAIN_THRESHOLD != 0 && rpp::details::observables::chain_length_v<TStrategy> >= RPP_TYPE_ERASURE_CHAIN_THRESHOLD)
+                return std::move(chain).as_dynamic();
+            else
+                return std::move(chain);
         }
 
     private:
         RPP_NO_UNIQUE_ADDRESS Strategy m_strategy;
     };
 } // namespace rpp
+
+#if RPP_TYPE_ERASURE_CHAIN_THRESHOLD != 0
+    // long chains are converted to dynamic_observable
+    #include <rpp/observables/dynamic_observable.hpp>
+#endif
@@ -30,11 +30,14 @@
  * @ingroup operators
  */
 
+#include <rpp/operators/adaptive_batch.hpp>
 #include <rpp/operators/buffer.hpp>
 #include <rpp/operators/flat_map.hpp>
 #include <rpp/operators/group_by.hpp>
 #include <rpp/operators/map.hpp>
+#include <rpp/operators/memoize.hpp>
 #include <rpp/operators/scan.hpp>
+#include <rpp/operators/scan_by_key.hpp>
 #include <rpp/operators/subscribe.hpp>
 #include <rpp/operators/window.hpp>
 #include <rpp/operators/window_toggle.hpp>
@@ -52,6 +55,8 @@
 #include <rpp/operators/filter.hpp>
 #include <rpp/operators/first.hpp>
 #include <rpp/operators/last.hpp>
+#include <rpp/operators/rate_limit.hpp>
+#include <rpp/operators/sample.hpp>
 #include <rpp/operators/skip.hpp>
 #include <rpp/operators/take.hpp>
 #include <rpp/operators/take_last.hpp>
@@ -76,7 +81,9 @@
  */
 
 #include <rpp/operators/combine_latest.hpp>
+#include <rpp/operators/join_within.hpp>
 #include <rpp/operators/merge.hpp>
+#include <rpp/operators/merge_with_priority.hpp>
 #include <rpp/operators/start_with.hpp>
 #include <rpp/operators/switch_on_next.hpp>
 #include <rpp/operators/with_latest_from.hpp>
@@ -91,9 +98,12 @@
  */
 
 #include <rpp/operators/as_blocking.hpp>
+#include <rpp/operators/conflate_by_key.hpp>
 #include <rpp/operators/delay.hpp>
 #include <rpp/operators/finally.hpp>
 #include <rpp/operators/observe_on.hpp>
+#include <rpp/operators/parallel.hpp>
+#include <rpp/operators/reorder_by.hpp>
 #include <rpp/operators/repeat.hpp>
 #include <rpp/operators/subscribe_on.hpp>
 #include <rpp/operators/tap.hpp>
@@ -116,8 +126,11 @@
  * @ingroup operators
  */
 
+#include <rpp/operators/approx_count_distinct.hpp>
 #include <rpp/operators/concat.hpp>
+#include <rpp/operators/quantiles.hpp>
 #include <rpp/operators/reduce.hpp>
+#include <rpp/operators/top_k.hpp>
 
 /**
  * @defgroup error_handling_operators Error Handling Operators
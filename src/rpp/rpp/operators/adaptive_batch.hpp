@@ -0,0 +1,304 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/operators/fwd.hpp>
+
+#include <rpp/defs.hpp>
+#include <rpp/disposables/composite_disposable.hpp>
+#include <rpp/operators/details/strategy.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace rpp::operators::details
+{
+    template<rpp::constraint::observer Observer, typename Worker, rpp::details::disposables::constraint::disposable_container Container>
+    class adaptive_batch_disposable;
+
+    template<rpp::constraint::observer Observer, typename Worker, rpp::details::disposables::constraint::disposable_container Container>
+    struct adaptive_batch_disposable_wrapper
+    {
+        std::shared_ptr<adaptive_batch_disposable<Observer, Worker, Container>> disposable{};
+        size_t                                                                  generation{};
+
+        bool is_disposed() const { return disposable->is_disposed(); }
+
+        void on_error(const std::exception_ptr& err) const { disposable->observer.on_error(err); }
+    };
+
+    template<rpp::constraint::observer Observer, typename Worker, rpp::details::disposables::constraint::disposable_container Container>
+    class adaptive_batch_disposable final : public rpp::composite_disposable_impl<Container>
+        , public rpp::details::enable_wrapper_from_this<adaptive_batch_disposable<Observer, Worker, Container>>
+    {
+        using container  = rpp::utils::extract_observer_type_t<Observer>;
+        using value_type = typename container::value_type;
+        static_assert(std::same_as<container, std::vector<value_type>>);
+
+    public:
+        adaptive_batch_disposable(Observer&& in_observer, Worker&& in_worker, size_t max_size, rpp::schedulers::duration max_delay)
+            : observer(std::move(in_observer))
+            , m_worker{std::move(in_worker)}
+            , m_max_size{std::max(size_t{1}, max_size)}
+            , m_max_delay{max_delay}
+        {
+            if constexpr (!Worker::is_none_disposable)
+            {
+                if (auto d = m_worker.get_disposable(); !d.is_disposed())
+                    rpp::composite_disposable_impl<Container>::add(std::move(d));
+            }
+        }
+
+        template<typename TT>
+        void on_next(TT&& v)
+        {
+            size_t generation;
+            {
+                std::lock_guard lock{m_mutex};
+                if (m_pending.empty())
+                    m_oldest_pending_time = m_worker.now();
+                m_pending.emplace_back(std::forward<TT>(v));
+
+                // consumer is idle: emit immediately. consumer is waiting to fill batch but batch is full: emit without waiting
+                if (!m_is_busy)
+                    m_is_busy = true;
+                else if (!m_is_lingering || m_pending.size() < m_max_size)
+                    return;
+
+                generation = restart_drain_under_lock();
+            }
+            schedule_drain(generation);
+        }
+
+        void on_error(const std::exception_ptr& err)
+        {
+            if (!terminate([&] { m_error = err; }))
+            {
+                this->dispose();
+                observer.on_error(err);
+            }
+        }
+
+        void on_completed()
+        {
+            if (!terminate([&] { m_completed = true; }))
+            {
+                this->dispose();
+                observer.on_completed();
+            }
+        }
+
+        std::optional<rpp::schedulers::time_point> drain(size_t generation)
+        {
+            std::unique_lock lock{m_mutex};
+            // drain was rescheduled to emit earlier, so, this one is outdated
+            if (generation != m_generation)
+                return std::nullopt;
+
+            while (true)
+            {
+                if (m_error)
+                {
+                    const auto err = m_error.value();
+                    m_pending.clear();
+                    lock.unlock();
+                    this->dispose();
+                    observer.on_error(err);
+                    return std::nullopt;
+                }
+
+                if (m_pending.empty())
+                {
+                    m_is_busy            = false;
+                    m_is_under_load      = false;
+                    const bool completed = m_completed;
+                    lock.unlock();
+                    if (completed)
+                    {
+                        this->dispose();
+                        observer.on_completed();
+                    }
+                    return std::nullopt;
+                }
+
+                // emissions arrived while consumer processed previous batch, so, it is worth to wait a bit to fill batch
+                const auto deadline = m_oldest_pending_time + m_max_delay;
+                m_is_lingering      = m_is_under_load && !m_completed && m_pending.size() < m_max_size && m_worker.now() < deadline;
+                if (m_is_lingering)
+                    return deadline;
+
+                auto batch = extract_batch_under_lock();
+                lock.unlock();
+                observer.on_next(std::move(batch));
+                lock.lock();
+                m_is_under_load = !m_pending.empty();
+            }
+        }
+
+        Observer observer;
+
+    private:
+        /**
+         * @return false if observer is idle and there is nothing pending, so, terminal event can be emitted in-place
+         */
+        template<typename Fn>
+        bool terminate(Fn&& set_state)
+        {
+            size_t generation;
+            {
+                std::lock_guard lock{m_mutex};
+                if (!m_is_busy)
+                    return false;
+
+                set_state();
+                // drain waits to fill batch, so, restart it to emit pending batch and terminal event without waiting
+                if (!m_is_lingering)
+                    return true;
+                generation = restart_drain_under_lock();
+            }
+            schedule_drain(generation);
+            return true;
+        }
+
+        size_t restart_drain_under_lock()
+        {
+            m_is_lingering = false;
+            return ++m_generation;
+        }
+
+        container extract_batch_under_lock()
+        {
+            if (m_pending.size() <= m_max_size)
+                return std::exchange(m_pending, container{});
+
+            // rest of emissions are already overdue, so, keep time of oldest pending emission as is to emit them on next iteration
+            container batch(std::make_move_iterator(m_pending.begin()), std::make_move_iterator(m_pending.begin() + static_cast<std::ptrdiff_t>(m_max_size)));
+            m_pending.erase(m_pending.begin(), m_pending.begin() + static_cast<std::ptrdiff_t>(m_max_size));
+            return batch;
+        }
+
+        void schedule_drain(size_t generation)
+        {
+            using wrapper = adaptive_batch_disposable_wrapper<Observer, Worker, Container>;
+            m_worker.schedule(
+                [](const wrapper& handler) -> rpp::schedulers::optional_delay_to {
+                    if (const auto next = handler.disposable->drain(handler.generation))
+                        return rpp::schedulers::optional_delay_to{next.value()};
+                    return std::nullopt;
+                },
+                wrapper{this->wrapper_from_this().lock(), generation});
+        }
+
+        RPP_NO_UNIQUE_ADDRESS Worker m_worker;
+        std::mutex                   m_mutex{};
+        size_t                       m_max_size;
+        rpp::schedulers::duration    m_max_delay;
+
+        container                         m_pending{};
+        rpp::schedulers::time_point       m_oldest_pending_time{};
+        std::optional<std::exception_ptr> m_error{};
+        size_t                            m_generation{};
+        bool                              m_completed{};
+        bool                              m_is_busy{};
+        bool                              m_is_under_load{};
+        bool                              m_is_lingering{};
+    };
+
+    template<rpp::constraint::observer Observer, typename Worker, rpp::details::disposables::constraint::disposable_container Container>
+    struct adaptive_batch_observer_strategy
+    {
+        std::shared_ptr<adaptive_batch_disposable<Observer, Worker, Container>> disposable{};
+
+        void set_upstream(const rpp::disposable_wrapper& d) const { disposable->add(d); }
+
+        bool is_disposed() const { return disposable->is_disposed(); }
+
+        template<typename T>
+        void on_next(T&& v) const
+        {
+            disposable->on_next(std::forward<T>(v));
+        }
+
+        void on_error(const std::exception_ptr& err) const { disposable->on_error(err); }
+
+        void on_completed() const { disposable->on_completed(); }
+    };
+
+    template<rpp::schedulers::constraint::scheduler Scheduler>
+    struct adaptive_batch_t
+    {
+        template<rpp::constraint::decayed_type T>
+        struct operator_traits
+        {
+            using result_type = std::vector<T>;
+        };
+
+        template<rpp::details::observables::constraint::disposable_strategy Prev>
+        using updated_disposable_strategy = rpp::details::observables::fixed_disposable_strategy_selector<1>;
+
+        size_t                          max_size;
+        rpp::schedulers::duration       max_delay;
+        RPP_NO_UNIQUE_ADDRESS Scheduler scheduler;
+
+        template<rpp::constraint::decayed_type Type, rpp::details::observables::constraint::disposable_strategy DisposableStrategy, rpp::constraint::observer Observer>
+        auto lift_with_disposable_strategy(Observer&& observer) const
+        {
+            using worker_t     = rpp::schedulers::utils::get_worker_t<Scheduler>;
+            using container    = typename DisposableStrategy::template add<worker_t::is_none_disposable ? 0 : 1>::disposable_container;
+            using disposable_t = adaptive_batch_disposable<std::decay_t<Observer>, worker_t, container>;
+
+            const auto disposable = disposable_wrapper_impl<disposable_t>::make(std::forward<Observer>(observer), scheduler.create_worker(), max_size, max_delay);
+            auto       ptr        = disposable.lock();
+            ptr->observer.set_upstream(disposable.as_weak());
+            return rpp::observer<Type, adaptive_batch_observer_strategy<std::decay_t<Observer>, worker_t, container>>{std::move(ptr)};
+        }
+    };
+} // namespace rpp::operators::details
+
+namespace rpp::operators
+{
+    /**
+     * @brief Periodically gather emissions emitted by an original Observable into batches and emit them via scheduler. Size of batches adapts to speed of observer: observer is idle - emissions are emitted as singletons, observer is busy - batches grow up to `max_size`.
+     *
+     * @marble adaptive_batch
+     {
+         source observable                  : +-1---2345---|
+         operator "adaptive_batch(3, busy)" : +-{1}-{2}{3,4,5}-|
+     }
+     *
+     * @details Emissions are delivered to observer via worker of provided scheduler. Observer is considered as busy while batch is in-flight: scheduled but not processed yet or processing right now.
+     * - When observer is idle, new emission is scheduled immediately as singleton batch, so, there is no additional latency at light load.
+     * - Emissions arrived while observer is busy are accumulated. If any emissions arrived during processing of previous batch, operator waits for batch to be filled up to `max_size`, but no longer than `max_delay` since arrival of the oldest pending emission.
+     * - Full batch is emitted immediately.
+     * @details on_completed/on_error are forwarded after pending batches (on_error drops pending emissions).
+     *
+     * @par Performance notes:
+     * - 1 heap allocation for state
+     * - Mutex acquired every emission, emissions are moved/copied into pending batch
+     * - Under saturation scheduler is touched once per batch instead of once per emission
+     *
+     * @param max_size is maximal size of batch
+     * @param max_delay is maximal time emission can wait for its batch to be filled while observer is busy
+     * @param scheduler is scheduler used to deliver batches and to measure time
+     *
+     * @warning #include <rpp/operators/adaptive_batch.hpp>
+     *
+     * @ingroup transforming_operators
+     */
+    template<rpp::schedulers::constraint::scheduler Scheduler>
+    auto adaptive_batch(size_t max_size, rpp::schedulers::duration max_delay, Scheduler&& scheduler)
+    {
+        return details::adaptive_batch_t<std::decay_t<Scheduler>>{max_size, max_delay, std::forward<Scheduler>(scheduler)};
+    }
+} // namespace rpp::operators
@@ -0,0 +1,80 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/operators/fwd.hpp>
+
+#include <rpp/operators/details/sketch_strategy.hpp>
+#include <rpp/utils/sketches.hpp>
+
+namespace rpp::operators::details
+{
+    struct approx_count_distinct_policy
+    {
+        size_t precision;
+
+        template<rpp::constraint::decayed_type T>
+        rpp::utils::hyperloglog<T> make() const
+        {
+            static_assert(rpp::constraint::hashable<T>, "T is not hashable");
+            return rpp::utils::hyperloglog<T>{precision};
+        }
+
+        template<rpp::constraint::decayed_type T>
+        size_t result(const rpp::utils::hyperloglog<T>& sketch) const
+        {
+            return sketch.estimate();
+        }
+    };
+} // namespace rpp::operators::details
+
+namespace rpp::operators
+{
+    /**
+     * @brief Emits approximate amount of distinct values emitted by observable when it completes.
+     *
+     * @marble approx_count_distinct
+     {
+         source observable                : +--1-2-1-3-2-|
+         operator "approx_count_distinct" : +------------3|
+     }
+     *
+     * @details Actually this operator feeds each emission into HyperLogLog sketch, so, memory is fixed (`2^precision` bytes) regardless of amount of distinct values, but result is approximate: relative error is ~`1.04/sqrt(2^precision)` (~1.6% for precision 12). Small cardinalities are counted almost exactly.
+     * @details Can be used as per-window aggregate too: `window(...) | flat_map([](auto w) { return w | approx_count_distinct(); })`
+     *
+     * @par Performance notes:
+     * - 1 heap allocation for registers during subscription
+     * - each emission is hashed and updates single byte register, no allocations
+     *
+     * @param precision is amount of bits of hash used to select register. Clamped into range [4;18].
+     *
+     * @warning #include <rpp/operators/approx_count_distinct.hpp>
+     *
+     * @ingroup aggregate_operators
+     * @see https://reactivex.io/documentation/operators/count.html
+     */
+    inline auto approx_count_distinct(size_t precision)
+    {
+        return details::sketch_t<details::approx_count_distinct_policy>{details::approx_count_distinct_policy{precision}};
+    }
+
+    /**
+     * @brief Same as rpp::operators::approx_count_distinct, but with precision 12 (4KB of registers).
+     *
+     * @warning #include <rpp/operators/approx_count_distinct.hpp>
+     *
+     * @ingroup aggregate_operators
+     */
+    inline auto approx_count_distinct()
+    {
+        return approx_count_distinct(12);
+    }
+} // namespace rpp::operators
@@ -13,6 +13,7 @@
 #include <rpp/operators/fwd.hpp>
 
 #include <rpp/defs.hpp>
+#include <rpp/disposables/demand_disposable.hpp>
 #include <rpp/operators/details/strategy.hpp>
 
 #include <cstddef>
@@ -55,7 +56,7 @@ namespace rpp::operators::details
             m_observer.on_completed();
         }
 
-        void set_upstream(const disposable_wrapper& d) { m_observer.set_upstream(d); }
+        void set_upstream(const disposable_wrapper& d) { m_observer.set_upstream(rpp::details::hide_demand(d)); }
 
         bool is_disposed() const { return m_observer.is_disposed(); }
 
@@ -12,11 +12,13 @@
 
 #include <rpp/operators/fwd.hpp>
 
+#include <rpp/disposables/demand_disposable.hpp>
 #include <rpp/disposables/refcount_disposable.hpp>
 #include <rpp/operators/details/strategy.hpp>
 #include <rpp/operators/details/utils.hpp>
 
 #include <cassert>
+#include <memory>
 #include <queue>
 
 
@@ -33,8 +35,9 @@ namespace rpp::operators::details
         Processing             = 3,
     };
 
-    template<rpp::constraint::observable TObservable, rpp::constraint::observer TObserver>
+    template<rpp::constraint::observable TObservable, rpp::constraint::observer TObserver, bool Padded = rpp::utils::pad_shared_states>
     class concat_state_t final : public rpp::refcount_disposable
+        , public rpp::interface_demand
     {
     public:
         concat_state_t(TObserver&& observer)
@@ -47,6 +50,26 @@ namespace rpp::operators::details
 
         std::atomic<ConcatStage>& stage() { return m_stage; }
 
+        // called by demand-aware downstream during subscription, so, before any inner subscription
+        void limit_demand(size_t initial) noexcept override { m_demand.limit(initial); }
+
+        void request(size_t n) noexcept override
+        {
+            if (m_demand.is_limited())
+                m_demand.request(n);
+        }
+
+        bool is_demand_limited() const { return m_demand.is_limited(); }
+
+        // only currently subscribed inner observable obtains demand of downstream
+        void set_inner_demand(const std::shared_ptr<interface_demand>& demand) { m_demand.set_inner(demand); }
+
+        void consume_demand()
+        {
+            if (m_demand.is_limited())
+                m_demand.consume();
+        }
+
         void drain(rpp::composite_disposable_wrapper refcounted)
         {
             while (!is_disposed())
@@ -97,9 +120,14 @@ namespace rpp::operators::details
         }
 
     private:
-        value_with_mutex<TObserver>               m_observer;
-        value_with_mutex<std::queue<TObservable>> m_queue;
-        std::atomic<ConcatStage>                  m_stage{};
+        rpp::details::demand_forwarder m_demand{};
+
+        // outer observable pushes to queue while inner one emits and completes from (possibly) other thread: each of them is kept in its own cache line apart from read-mostly fields
+        alignas(rpp::utils::cache_line_alignment_v<value_with_mutex<TObserver>, Padded>) value_with_mutex<TObserver> m_observer;
+
+        alignas(rpp::utils::cache_line_alignment_v<value_with_mutex<std::queue<TObservable>>, Padded>) value_with_mutex<std::queue<TObservable>> m_queue;
+
+        alignas(rpp::utils::cache_line_alignment_v<std::atomic<ConcatStage>, Padded>) std::atomic<ConcatStage> m_stage{};
     };
 
     template<rpp::constraint::observable TObservable, rpp::constraint::observer TObserver>
@@ -137,9 +165,21 @@ namespace rpp::operators::details
 
         using base::concat_observer_strategy_base;
 
+        void set_upstream(const disposable_wrapper& d) const
+        {
+            base::set_upstream(d);
+
+            if (!base::state->is_demand_limited())
+                return;
+
+            if (const auto demand = rpp::details::get_demand(d))
+                base::state->set_inner_demand(demand);
+        }
+
         template<typename T>
         void on_next(T&& v) const
         {
+            base::state->consume_demand();
             base::state->get_observer()->on_next(std::forward<T>(v));
         }
 
@@ -229,6 +269,7 @@ namespace rpp::operators
      }
      *
      * @details Actually it subscribes on first observable from emissions. When first observable completes, then it subscribes on second observable from emissions and etc...
+     * @details In case of demand-aware downstream (see rpp::operators::observe_on_bounded) outstanding demand is forwarded to currently subscribed inner observable if it is demand-aware.
      *
      * @tparam MemoryModel rpp::memory_model strategy used to handle provided observables
      *
@@ -0,0 +1,260 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/operators/fwd.hpp>
+
+#include <rpp/defs.hpp>
+#include <rpp/disposables/composite_disposable.hpp>
+#include <rpp/operators/details/strategy.hpp>
+#include <rpp/utils/constraints.hpp>
+#include <rpp/utils/open_addressing_map.hpp>
+
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace rpp::operators::details
+{
+    template<rpp::constraint::observer Observer, typename Worker, rpp::details::disposables::constraint::disposable_container Container, rpp::constraint::decayed_type KeySelector>
+    class conflate_by_key_disposable final : public rpp::composite_disposable_impl<Container>
+    {
+        using T    = rpp::utils::extract_observer_type_t<Observer>;
+        using TKey = rpp::utils::decayed_invoke_result_t<KeySelector, T>;
+
+    public:
+        conflate_by_key_disposable(Observer&& in_observer, Worker&& in_worker, const KeySelector& key_selector)
+            : observer(std::move(in_observer))
+            , worker{std::move(in_worker)}
+            , m_key_selector{key_selector}
+        {
+            if constexpr (!Worker::is_none_disposable)
+            {
+                if (auto d = worker.get_disposable(); !d.is_disposed())
+                    rpp::composite_disposable_impl<Container>::add(std::move(d));
+            }
+        }
+
+        /**
+         * @brief Replaces pending value with same key (keeping its position) or appends new one
+         * @return true if drain is not active and has to be scheduled
+         */
+        template<typename TT>
+        bool emplace(TT&& v)
+        {
+            auto            key = m_key_selector(rpp::utils::as_const(v));
+            std::lock_guard lock{m_mutex};
+            if (const auto [position, inserted] = m_index.try_emplace(key, m_pending.size()); !inserted)
+                m_pending[*position].emplace(std::forward<TT>(v));
+            else
+                m_pending.emplace_back(std::forward<TT>(v));
+            return !std::exchange(m_is_active, true);
+        }
+
+        bool emplace_error(const std::exception_ptr& err)
+        {
+            std::lock_guard lock{m_mutex};
+            m_error = err;
+            return !std::exchange(m_is_active, true);
+        }
+
+        bool emplace_completed()
+        {
+            std::lock_guard lock{m_mutex};
+            m_completed = true;
+            return !std::exchange(m_is_active, true);
+        }
+
+        /**
+         * @brief Emits all currently pending values as single conflated batch
+         * @return true if drain has to be re-scheduled to check for values arrived during emission
+         */
+        bool drain()
+        {
+            std::optional<std::exception_ptr> err{};
+            bool                              completed{};
+            {
+                std::lock_guard lock{m_mutex};
+                if (m_error)
+                {
+                    // same as observe_on: error cancels not emitted yet values
+                    err = m_error;
+                    m_pending.clear();
+                    m_index.clear();
+                }
+                else if (m_pending.empty())
+                {
+                    completed   = m_completed;
+                    m_is_active = completed;
+                }
+                else
+                {
+                    // buffers are swapped to keep capacity of both of them and avoid reallocations
+                    std::swap(m_pending, m_draining);
+                    m_index.clear();
+                }
+            }
+
+            if (err)
+            {
+                observer.on_error(err.value());
+                return false;
+            }
+
+            if (m_draining.empty())
+            {
+                if (completed)
+                    observer.on_completed();
+                return false;
+            }
+
+            for (auto& v : m_draining)
+            {
+                if (observer.is_disposed())
+                    break;
+                observer.on_next(std::move(v).value());
+            }
+            m_draining.clear();
+            return true;
+        }
+
+        Observer                     observer;
+        RPP_NO_UNIQUE_ADDRESS Worker worker;
+
+    private:
+        RPP_NO_UNIQUE_ADDRESS KeySelector m_key_selector;
+
+        std::mutex                                    m_mutex{};
+        std::vector<std::optional<T>>                 m_pending{};
+        std::vector<std::optional<T>>                 m_draining{};
+        rpp::utils::open_addressing_map<TKey, size_t> m_index{};
+        std::optional<std::exception_ptr>             m_error{};
+        bool                                          m_completed{};
+        bool                                          m_is_active{};
+    };
+
+    template<rpp::constraint::observer Observer, typename Worker, rpp::details::disposables::constraint::disposable_container Container, rpp::constraint::decayed_type KeySelector>
+    struct conflate_by_key_disposable_wrapper
+    {
+        std::shared_ptr<conflate_by_key_disposable<Observer, Worker, Container, KeySelector>> disposable{};
+
+        bool is_disposed() const { return disposable->is_disposed(); }
+
+        void on_error(const std::exception_ptr& err) const { disposable->observer.on_error(err); }
+    };
+
+    template<rpp::constraint::observer Observer, typename Worker, rpp::details::disposables::constraint::disposable_container Container, rpp::constraint::decayed_type KeySelector>
+    struct conflate_by_key_observer_strategy
+    {
+        std::shared_ptr<conflate_by_key_disposable<Observer, Worker, Container, KeySelector>> disposable{};
+
+        void set_upstream(const rpp::disposable_wrapper& d) const { disposable->add(d); }
+
+        bool is_disposed() const { return disposable->is_disposed(); }
+
+        template<typename T>
+        void on_next(T&& v) const
+        {
+            if (disposable->emplace(std::forward<T>(v)))
+                schedule_drain();
+        }
+
+        void on_error(const std::exception_ptr& err) const
+        {
+            if (disposable->emplace_error(err))
+                schedule_drain();
+        }
+
+        void on_completed() const
+        {
+            if (disposable->emplace_completed())
+                schedule_drain();
+        }
+
+    private:
+        void schedule_drain() const
+        {
+            disposable->worker.schedule(
+                [](const conflate_by_key_disposable_wrapper<Observer, Worker, Container, KeySelector>& wrapper) -> rpp::schedulers::optional_delay_from_now {
+                    if (wrapper.disposable->drain())
+                        return rpp::schedulers::delay_from_now{};
+                    return std::nullopt;
+                },
+                conflate_by_key_disposable_wrapper<Observer, Worker, Container, KeySelector>{disposable});
+        }
+    };
+
+    template<rpp::constraint::decayed_type KeySelector, rpp::schedulers::constraint::scheduler Scheduler>
+    struct conflate_by_key_t
+    {
+        template<rpp::constraint::decayed_type T>
+        struct operator_traits
+        {
+            static_assert(std::invocable<KeySelector, T>, "KeySelector is not invocacble with T");
+            static_assert(rpp::constraint::hashable<rpp::utils::decayed_invoke_result_t<KeySelector, T>>, "Result of KeySelector is not hashable");
+
+            using result_type = T;
+        };
+
+        template<rpp::details::observables::constraint::disposable_strategy Prev>
+        using updated_disposable_strategy = rpp::details::observables::fixed_disposable_strategy_selector<1>;
+
+        RPP_NO_UNIQUE_ADDRESS KeySelector key_selector;
+        RPP_NO_UNIQUE_ADDRESS Scheduler   scheduler;
+
+        template<rpp::constraint::decayed_type Type, rpp::details::observables::constraint::disposable_strategy DisposableStrategy, rpp::constraint::observer Observer>
+        auto lift_with_disposable_strategy(Observer&& observer) const
+        {
+            using worker_t     = rpp::schedulers::utils::get_worker_t<Scheduler>;
+            using container    = typename DisposableStrategy::template add<worker_t::is_none_disposable ? 0 : 1>::disposable_container;
+            using disposable_t = conflate_by_key_disposable<std::decay_t<Observer>, worker_t, container, KeySelector>;
+
+            const auto disposable = disposable_wrapper_impl<disposable_t>::make(std::forward<Observer>(observer), scheduler.create_worker(), key_selector);
+            auto       ptr        = disposable.lock();
+            ptr->observer.set_upstream(disposable.as_weak());
+            return rpp::observer<Type, conflate_by_key_observer_strategy<std::decay_t<Observer>, worker_t, container, KeySelector>>{std::move(ptr)};
+        }
+    };
+} // namespace rpp::operators::details
+
+namespace rpp::operators
+{
+    /**
+     * @brief Emit emissions via provided scheduler, but while downstream is busy keep only latest value per key.
+     * @details Values are kept in insertion-ordered map: new value with already pending key replaces pending one in place, new key is appended to the end. When scheduler executes drain, whole conflated set is emitted as single batch, values arrived during this emission form next batch.
+     * @details So, memory is bounded by amount of distinct keys and consumer never obtains stale value for any key. In contrast to `debounce`/`throttle` no key is skipped at all.
+     *
+     * @marble conflate_by_key
+        {
+            source observable                  : +-1-2-3-5-4-|
+            operator "conflate_by_key(x=>x%2)" : +-1---------45|
+        }
+     *
+     * @details Marble above shows case when consumer is busy with `1` till completion of source.
+     * @details on_error cancels all pending values and is forwarded to observer from scheduler as soon as possible (same as `observe_on`), on_completed is forwarded after all pending values.
+     *
+     * @par Performance notes:
+     * - 1 heap allocation for state
+     * - Acquiring mutex and hash map lookup for each emission, but no allocations after warm-up due to buffers and slots of hash map (open addressing, no node per key) are reused between batches
+     *
+     * @param key_selector is function which returns key for provided value. Result of this function should be hashable.
+     * @param scheduler provides the threading model for emissions (same as `observe_on`).
+     * @warning #include <rpp/operators/conflate_by_key.hpp>
+     *
+     * @ingroup utility_operators
+     */
+    template<typename KeySelector, rpp::schedulers::constraint::scheduler Scheduler>
+        requires (!utils::is_not_template_callable<KeySelector> || !std::same_as<void, std::invoke_result_t<KeySelector, rpp::utils::convertible_to_any>>)
+    auto conflate_by_key(KeySelector&& key_selector, Scheduler&& scheduler)
+    {
+        return details::conflate_by_key_t<std::decay_t<KeySelector>, std::decay_t<Scheduler>>{std::forward<KeySelector>(key_selector), std::forward<Scheduler>(scheduler)};
+    }
+} // namespace rpp::operators
@@ -14,6 +14,7 @@
 
 #include <rpp/defs.hpp>
 #include <rpp/disposables/composite_disposable.hpp>
+#include <rpp/disposables/demand_disposable.hpp>
 #include <rpp/operators/details/strategy.hpp>
 
 #include <mutex>
@@ -40,10 +41,11 @@ namespace rpp::operators::details
     {
         using T = rpp::utils::extract_observer_type_t<Observer>;
 
-        delay_disposable(Observer&& in_observer, Worker&& in_worker, rpp::schedulers::duration delay)
+        delay_disposable(Observer&& in_observer, Worker&& in_worker, rpp::schedulers::duration delay, size_t max_queue_size)
             : observer(std::move(in_observer))
             , worker{std::move(in_worker)}
             , delay{delay}
+            , max_queue_size{max_queue_size}
         {
             if constexpr (!Worker::is_none_disposable)
             {
@@ -55,10 +57,15 @@ namespace rpp::operators::details
         Observer                     observer;
         RPP_NO_UNIQUE_ADDRESS Worker worker;
         rpp::schedulers::duration    delay;
+        size_t                       max_queue_size;
 
-        std::mutex              mutex{};
-        std::queue<emission<T>> queue;
-        bool                    is_active{};
+        // demand-aware upstream limited to `max_queue_size` items in flight
+        std::weak_ptr<rpp::interface_demand> upstream_demand{};
+
+        // written by both emitting thread and thread of worker: kept apart from read-mostly fields above if worker can run in other thread
+        alignas(rpp::utils::cache_line_alignment_v<std::mutex, rpp::utils::pad_shared_states && !Worker::is_caller_thread_only>) std::mutex mutex{};
+        std::queue<emission<T>>                                                                                                             queue;
+        bool                                                                                                                                is_active{};
     };
 
     template<rpp::constraint::observer Observer, typename Worker, rpp::details::disposables::constraint::disposable_container Container>
@@ -79,6 +86,15 @@ namespace rpp::operators::details
         void set_upstream(const rpp::disposable_wrapper& d) const
         {
             disposable->add(d);
+
+            if (disposable->max_queue_size == 0)
+                return;
+
+            if (const auto demand = rpp::details::get_demand(d))
+            {
+                demand->limit_demand(disposable->max_queue_size);
+                disposable->upstream_demand = demand;
+            }
         }
 
         bool is_disposed() const
@@ -108,13 +124,36 @@ namespace rpp::operators::details
         {
             if (const auto tp = emplace_safe(std::forward<TT>(value)))
             {
-                disposable->worker.schedule(
-                    tp.value(),
-                    [](const delay_disposable_wrapper<Observer, Worker, Container>& wrapper) { return drain_queue(wrapper.disposable); },
-                    delay_disposable_wrapper<Observer, Worker, Container>{disposable});
+                if constexpr (Worker::is_inline_execution_supported)
+                {
+                    if (disposable->delay == rpp::schedulers::duration::zero() && try_drain_inline())
+                        return;
+                }
+
+                schedule_drain(tp.value());
             }
         }
 
+        void schedule_drain(rpp::schedulers::time_point tp) const
+        {
+            disposable->worker.schedule(
+                tp,
+                [](const delay_disposable_wrapper<Observer, Worker, Container>& wrapper) { return drain_queue(wrapper.disposable); },
+                delay_disposable_wrapper<Observer, Worker, Container>{disposable});
+        }
+
+        // we are already inside execution context of worker (and nothing is scheduled yet), so there is no need to hop via scheduling
+        bool try_drain_inline() const
+        {
+            schedulers::optional_delay_to next{};
+            if (!disposable->worker.execute_inline_if_current_thread([&] { next = drain_queue(disposable); }))
+                return false;
+
+            if (next)
+                schedule_drain(next->value);
+            return true;
+        }
+
         template<typename TT>
         std::optional<rpp::schedulers::time_point> emplace_safe(TT&& item) const
         {
@@ -157,7 +196,11 @@ namespace rpp::operators::details
                 disposable->queue.pop();
                 lock.unlock();
 
-                std::visit(rpp::utils::overloaded{[&](rpp::utils::extract_observer_type_t<Observer>&& v) { disposable->observer.on_next(std::move(v)); },
+                std::visit(rpp::utils::overloaded{[&](rpp::utils::extract_observer_type_t<Observer>&& v) {
+                                                      disposable->observer.on_next(std::move(v));
+                                                      // item left queue -> there is free space for one more
+                                                      request_one_more(disposable);
+                                                  },
                                                   [&](const std::exception_ptr& err) { disposable->observer.on_error(err); },
                                                   [&](rpp::utils::none) {
                                                       disposable->observer.on_completed();
@@ -165,6 +208,15 @@ namespace rpp::operators::details
                            std::move(item));
             }
         }
+
+        static void request_one_more(const std::shared_ptr<delay_disposable<Observer, Worker, Container>>& disposable)
+        {
+            if (disposable->max_queue_size == 0)
+                return;
+
+            if (const auto demand = disposable->upstream_demand.lock())
+                demand->request(1);
+        }
     };
 
     template<rpp::schedulers::constraint::scheduler Scheduler, bool ClearOnError>
@@ -181,6 +233,7 @@ namespace rpp::operators::details
 
         rpp::schedulers::duration       duration;
         RPP_NO_UNIQUE_ADDRESS Scheduler scheduler;
+        size_t                          max_queue_size{};
 
         template<rpp::constraint::decayed_type Type, rpp::details::observables::constraint::disposable_strategy DisposableStrategy, rpp::constraint::observer Observer>
         auto lift_with_disposable_strategy(Observer&& observer) const
@@ -188,7 +241,7 @@ namespace rpp::operators::details
             using worker_t  = rpp::schedulers::utils::get_worker_t<Scheduler>;
             using container = typename DisposableStrategy::template add<worker_t::is_none_disposable ? 0 : 1>::disposable_container;
 
-            const auto disposable = disposable_wrapper_impl<delay_disposable<std::decay_t<Observer>, worker_t, container>>::make(std::forward<Observer>(observer), scheduler.create_worker(), duration);
+            const auto disposable = disposable_wrapper_impl<delay_disposable<std::decay_t<Observer>, worker_t, container>>::make(std::forward<Observer>(observer), scheduler.create_worker(), duration, max_queue_size);
             auto       ptr        = disposable.lock();
             ptr->observer.set_upstream(disposable.as_weak());
             return rpp::observer<Type, delay_observer_strategy<std::decay_t<Observer>, worker_t, container, ClearOnError>>{std::move(ptr)};
@@ -0,0 +1,66 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/operators/fwd.hpp>
+
+#include <rpp/defs.hpp>
+#include <rpp/disposables/demand_disposable.hpp>
+#include <rpp/operators/details/strategy.hpp>
+
+namespace rpp::operators::details
+{
+    /**
+     * @brief Feeds each emission into sketch created by `Policy::make<T>()` and emits `Policy::result(sketch)` on completion.
+     */
+    template<rpp::constraint::observer TObserver, rpp::constraint::decayed_type T, rpp::constraint::decayed_type Policy>
+    struct sketch_observer_strategy
+    {
+        using preferred_disposable_strategy = rpp::details::observers::none_disposable_strategy;
+
+        RPP_NO_UNIQUE_ADDRESS TObserver observer;
+        RPP_NO_UNIQUE_ADDRESS Policy    policy;
+
+        mutable decltype(std::declval<const Policy&>().template make<T>()) sketch = policy.template make<T>();
+
+        void on_next(const T& v) const { sketch.add(v); }
+
+        void on_error(const std::exception_ptr& err) const { observer.on_error(err); }
+
+        void on_completed() const
+        {
+            observer.on_next(policy.result(sketch));
+            observer.on_completed();
+        }
+
+        void set_upstream(const disposable_wrapper& d) { observer.set_upstream(rpp::details::hide_demand(d)); }
+
+        bool is_disposed() const { return observer.is_disposed(); }
+    };
+
+    template<rpp::constraint::decayed_type Policy>
+    struct sketch_t : lift_operator<sketch_t<Policy>, Policy>
+    {
+        using operators::details::lift_operator<sketch_t<Policy>, Policy>::lift_operator;
+
+        template<rpp::constraint::decayed_type T>
+        struct operator_traits
+        {
+            using result_type = decltype(std::declval<const Policy&>().result(std::declval<const Policy&>().template make<T>()));
+
+            template<rpp::constraint::observer_of_type<result_type> TObserver>
+            using observer_strategy = sketch_observer_strategy<TObserver, T, Policy>;
+        };
+
+        template<rpp::details::observables::constraint::disposable_strategy Prev>
+        using updated_disposable_strategy = Prev;
+    };
+} // namespace rpp::operators::details
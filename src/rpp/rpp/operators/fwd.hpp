@@ -18,8 +18,17 @@
 #include <rpp/utils/constraints.hpp>
 #include <rpp/utils/utils.hpp>
 
+#include <vector>
+
 namespace rpp::operators
 {
+    template<rpp::schedulers::constraint::scheduler Scheduler>
+    auto adaptive_batch(size_t max_size, rpp::schedulers::duration max_delay, Scheduler&& scheduler);
+
+    auto approx_count_distinct(size_t precision);
+
+    auto approx_count_distinct();
+
     auto as_blocking();
 
     auto buffer(size_t count);
@@ -33,6 +42,10 @@ namespace rpp::operators
     template<rpp::constraint::observable TObservable, rpp::constraint::observable... TObservables>
     auto combine_latest(TObservable&& observable, TObservables&&... observables);
 
+    template<typename KeySelector, rpp::schedulers::constraint::scheduler Scheduler>
+        requires (!utils::is_not_template_callable<KeySelector> || !std::same_as<void, std::invoke_result_t<KeySelector, rpp::utils::convertible_to_any>>)
+    auto conflate_by_key(KeySelector&& key_selector, Scheduler&& scheduler);
+
     template<rpp::schedulers::constraint::scheduler Scheduler>
     auto debounce(rpp::schedulers::duration period, Scheduler&& scheduler);
 
@@ -65,12 +78,21 @@ namespace rpp::operators
             (!utils::is_not_template_callable<KeySelector> || !std::same_as<void, std::invoke_result_t<KeySelector, rpp::utils::convertible_to_any>>) && (!utils::is_not_template_callable<ValueSelector> || !std::same_as<void, std::invoke_result_t<ValueSelector, rpp::utils::convertible_to_any>>) && (!utils::is_not_template_callable<KeyComparator> || std::strict_weak_order<KeyComparator, rpp::utils::convertible_to_any, rpp::utils::convertible_to_any>))
     auto group_by(KeySelector&& key_selector, ValueSelector&& value_selector = {}, KeyComparator&& comparator = {});
 
+    template<rpp::constraint::observable TObservable, typename LeftKeySelector, typename RightKeySelector, typename Selector, rpp::schedulers::constraint::scheduler Scheduler>
+    auto join_within(TObservable&& other, LeftKeySelector&& left_key, RightKeySelector&& right_key, rpp::schedulers::duration window, Selector&& selector, Scheduler&& scheduler, size_t max_size_per_side);
+
+    template<rpp::constraint::observable TObservable, typename LeftKeySelector, typename RightKeySelector, typename Selector, rpp::schedulers::constraint::scheduler Scheduler>
+    auto join_within(TObservable&& other, LeftKeySelector&& left_key, RightKeySelector&& right_key, rpp::schedulers::duration window, Selector&& selector, Scheduler&& scheduler);
+
     auto last();
 
     template<typename Fn>
         requires (!utils::is_not_template_callable<Fn> || !std::same_as<void, std::invoke_result_t<Fn, rpp::utils::convertible_to_any>>)
     auto map(Fn&& callable);
 
+    template<typename KeyFn, typename Fn>
+    auto memoize(KeyFn&& key_fn, Fn&& fn, size_t capacity, rpp::schedulers::duration ttl);
+
     template<rpp::constraint::subject Subject>
     auto multicast(Subject&& subject);
 
@@ -86,11 +108,46 @@ namespace rpp::operators
     auto merge_with(TObservable&& observable, TObservables&&... observables);
     auto merge();
 
+    namespace details
+    {
+        template<rpp::constraint::observable TObservable>
+        struct prioritized_observable;
+    } // namespace details
+
+    template<rpp::constraint::observable... TObservables>
+    auto merge_with_priority(int priority, size_t max_queue_size, details::prioritized_observable<TObservables>... observables);
+
     template<rpp::schedulers::constraint::scheduler Scheduler>
     auto observe_on(Scheduler&& scheduler, rpp::schedulers::duration delay_duration = {});
 
+    template<rpp::schedulers::constraint::scheduler Scheduler>
+    auto observe_on_bounded(Scheduler&& scheduler, size_t max_queue_size);
+
+    template<rpp::schedulers::constraint::scheduler Scheduler>
+    auto parallel(size_t rails, Scheduler&& scheduler);
+
+    template<rpp::schedulers::constraint::scheduler Scheduler, typename KeySelector>
+        requires (!utils::is_not_template_callable<KeySelector> || !std::same_as<void, std::invoke_result_t<KeySelector, rpp::utils::convertible_to_any>>)
+    auto parallel(size_t rails, Scheduler&& scheduler, KeySelector&& key_selector);
+
+    auto sequential();
+
+    auto sequential_ordered();
+
     auto publish();
 
+    namespace rate_limit_policy
+    {
+        struct drop;
+        struct delay;
+    } // namespace rate_limit_policy
+
+    template<rpp::schedulers::constraint::scheduler Scheduler>
+    auto rate_limit(rpp::schedulers::duration rate, size_t burst, const Scheduler& scheduler, rate_limit_policy::drop policy);
+
+    template<rpp::schedulers::constraint::scheduler Scheduler>
+    auto rate_limit(rpp::schedulers::duration rate, size_t burst, Scheduler&& scheduler, rate_limit_policy::delay policy);
+
     template<typename Seed, typename Accumulator>
         requires (!utils::is_not_template_callable<Accumulator> || std::same_as<std::decay_t<Seed>, std::invoke_result_t<Accumulator, std::decay_t<Seed> &&, rpp::utils::convertible_to_any>>)
     auto reduce(Seed&& seed, Accumulator&& accumulator);
@@ -98,12 +155,37 @@ namespace rpp::operators
     template<typename Accumulator>
     auto reduce(Accumulator&& accumulator);
 
+    template<typename KeySelector, typename InitialValue, typename Fn>
+        requires (!utils::is_not_template_callable<Fn> || std::same_as<std::decay_t<InitialValue>, std::invoke_result_t<Fn, std::decay_t<InitialValue> &&, rpp::utils::convertible_to_any>>)
+    auto reduce_by_key(KeySelector&& key_selector, InitialValue&& initial_value, Fn&& accumulator);
+
+    template<typename KeySelector, typename InitialValue, typename Fn, rpp::schedulers::constraint::scheduler Scheduler>
+        requires (!utils::is_not_template_callable<Fn> || std::same_as<std::decay_t<InitialValue>, std::invoke_result_t<Fn, std::decay_t<InitialValue> &&, rpp::utils::convertible_to_any>>)
+    auto reduce_by_key(KeySelector&& key_selector, InitialValue&& initial_value, Fn&& accumulator, rpp::schedulers::duration idle_timeout, const Scheduler& scheduler);
+
     auto ref_count();
 
+    auto quantiles(std::vector<double> ranks, size_t k);
+
+    auto quantiles(std::vector<double> ranks);
+
+    template<typename TimestampSelector, rpp::schedulers::constraint::scheduler Scheduler>
+        requires (!utils::is_not_template_callable<TimestampSelector> || !std::same_as<void, std::invoke_result_t<TimestampSelector, rpp::utils::convertible_to_any>>)
+    auto reorder_by(TimestampSelector&& timestamp_selector, rpp::schedulers::duration max_lateness, Scheduler&& scheduler);
+
+    struct reorder_stats;
+
+    template<typename TimestampSelector, rpp::schedulers::constraint::scheduler Scheduler>
+        requires (!utils::is_not_template_callable<TimestampSelector> || !std::same_as<void, std::invoke_result_t<TimestampSelector, rpp::utils::convertible_to_any>>)
+    auto reorder_by(TimestampSelector&& timestamp_selector, rpp::schedulers::duration max_lateness, Scheduler&& scheduler, std::shared_ptr<reorder_stats> stats);
+
     auto repeat(size_t count);
 
     auto repeat();
 
+    template<rpp::schedulers::constraint::scheduler Scheduler>
+    auto sample(rpp::schedulers::duration period, Scheduler&& scheduler);
+
     template<typename InitialValue, typename Fn>
         requires (!utils::is_not_template_callable<Fn> || std::same_as<std::decay_t<InitialValue>, std::invoke_result_t<Fn, std::decay_t<InitialValue> &&, rpp::utils::convertible_to_any>>)
     auto scan(InitialValue&& initial_value, Fn&& accumulator);
@@ -111,6 +193,14 @@ namespace rpp::operators
     template<typename Fn>
     auto scan(Fn&& accumulator);
 
+    template<typename KeySelector, typename InitialValue, typename Fn>
+        requires (!utils::is_not_template_callable<Fn> || std::same_as<std::decay_t<InitialValue>, std::invoke_result_t<Fn, std::decay_t<InitialValue> &&, rpp::utils::convertible_to_any>>)
+    auto scan_by_key(KeySelector&& key_selector, InitialValue&& initial_value, Fn&& accumulator);
+
+    template<typename KeySelector, typename InitialValue, typename Fn, rpp::schedulers::constraint::scheduler Scheduler>
+        requires (!utils::is_not_template_callable<Fn> || std::same_as<std::decay_t<InitialValue>, std::invoke_result_t<Fn, std::decay_t<InitialValue> &&, rpp::utils::convertible_to_any>>)
+    auto scan_by_key(KeySelector&& key_selector, InitialValue&& initial_value, Fn&& accumulator, rpp::schedulers::duration idle_timeout, const Scheduler& scheduler);
+
     auto skip(size_t count);
 
     template<rpp::constraint::observable TObservable, rpp::constraint::observable... TObservables>
@@ -170,6 +260,10 @@ namespace rpp::operators
     template<rpp::schedulers::constraint::scheduler Scheduler = rpp::schedulers::immediate>
     auto throttle(rpp::schedulers::duration period);
 
+    auto top_k(size_t k, size_t capacity);
+
+    auto top_k(size_t k);
+
     template<typename Selector>
         requires rpp::constraint::observable<std::invoke_result_t<Selector, std::exception_ptr>>
     auto on_error_resume_next(Selector&& selector);
@@ -181,6 +275,9 @@ namespace rpp::operators
     template<rpp::constraint::observable TObservable, rpp::constraint::observable... TObservables>
     auto with_latest_from(TObservable&& observable, TObservables&&... observables);
 
+    template<rpp::constraint::observable TObservable>
+    auto with_priority(TObservable&& observable, int priority);
+
     auto window(size_t count);
 
     template<rpp::constraint::observable TOpeningsObservable, typename TClosingsSelectorFn>
@@ -0,0 +1,448 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/operators/fwd.hpp>
+
+#include <rpp/defs.hpp>
+#include <rpp/disposables/composite_disposable.hpp>
+#include <rpp/operators/details/strategy.hpp>
+#include <rpp/schedulers/current_thread.hpp>
+#include <rpp/utils/open_addressing_map.hpp>
+
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <optional>
+
+namespace rpp::operators::details
+{
+    /**
+     * @brief Values of one side of join_within stored in arrival order plus hash index by key to find matches.
+     * @details Values of same key are linked into list by sequence numbers of arrivals, so, there is no any allocation per key and the oldest value of the whole side is always the head of its key.
+     */
+    template<rpp::constraint::decayed_type TKey, rpp::constraint::decayed_type T>
+    class join_within_side
+    {
+        static constexpr size_t s_npos = std::numeric_limits<size_t>::max();
+
+        struct arrival
+        {
+            schedulers::time_point time;
+            TKey                   key;
+            T                      value;
+            size_t                 next_seq = s_npos;
+        };
+
+        struct key_range
+        {
+            size_t head_seq;
+            size_t tail_seq;
+        };
+
+    public:
+        template<typename Fn>
+        void for_each_match(const TKey& key, Fn&& fn) const
+        {
+            if (const auto* range = m_index.find(key))
+            {
+                for (size_t seq = range->head_seq; seq != s_npos; seq = at(seq).next_seq)
+                    fn(at(seq).value);
+            }
+        }
+
+        template<typename TT>
+        void push(schedulers::time_point now, TKey key, TT&& v, size_t max_size)
+        {
+            if (m_arrivals.size() >= max_size)
+                pop_oldest();
+
+            const size_t seq = m_base_seq + m_arrivals.size();
+            if (const auto [range, inserted] = m_index.try_emplace(key, key_range{seq, seq}); !inserted)
+                at(std::exchange(range->tail_seq, seq)).next_seq = seq;
+
+            m_arrivals.push_back(arrival{now, std::move(key), std::forward<TT>(v)});
+        }
+
+        /**
+         * @brief Drops all values arrived `window` or more ago
+         */
+        void expire(schedulers::time_point now, schedulers::duration window)
+        {
+            while (!m_arrivals.empty() && now - m_arrivals.front().time >= window)
+                pop_oldest();
+        }
+
+        std::optional<schedulers::time_point> oldest_arrival() const
+        {
+            if (m_arrivals.empty())
+                return std::nullopt;
+            return m_arrivals.front().time;
+        }
+
+    private:
+        arrival& at(size_t seq) { return m_arrivals[seq - m_base_seq]; }
+
+        const arrival& at(size_t seq) const { return m_arrivals[seq - m_base_seq]; }
+
+        void pop_oldest()
+        {
+            const auto& oldest = m_arrivals.front();
+            if (oldest.next_seq == s_npos)
+                m_index.erase(oldest.key);
+            else
+                m_index.find(oldest.key)->head_seq = oldest.next_seq;
+
+            m_arrivals.pop_front();
+            ++m_base_seq;
+        }
+
+        rpp::utils::open_addressing_map<TKey, key_range> m_index{};
+        std::deque<arrival>                              m_arrivals{};
+        size_t                                           m_base_seq{};
+    };
+
+    template<rpp::constraint::observer Observer, typename Worker, typename LeftKeySelector, typename RightKeySelector, typename Selector, rpp::constraint::decayed_type TLeft, rpp::constraint::decayed_type TRight>
+    class join_within_disposable;
+
+    template<rpp::constraint::observer Observer, typename Worker, typename LeftKeySelector, typename RightKeySelector, typename Selector, rpp::constraint::decayed_type TLeft, rpp::constraint::decayed_type TRight>
+    struct join_within_disposable_wrapper
+    {
+        std::shared_ptr<join_within_disposable<Observer, Worker, LeftKeySelector, RightKeySelector, Selector, TLeft, TRight>> disposable{};
+
+        bool is_disposed() const { return disposable->is_disposed(); }
+
+        void on_error(const std::exception_ptr& err) const { disposable->on_error(err); }
+    };
+
+    template<rpp::constraint::observer Observer, typename Worker, typename LeftKeySelector, typename RightKeySelector, typename Selector, rpp::constraint::decayed_type TLeft, rpp::constraint::decayed_type TRight>
+    class join_within_disposable final : public composite_disposable
+        , public rpp::details::enable_wrapper_from_this<join_within_disposable<Observer, Worker, LeftKeySelector, RightKeySelector, Selector, TLeft, TRight>>
+    {
+        using TKey    = rpp::utils::decayed_invoke_result_t<LeftKeySelector, TLeft>;
+        using TResult = rpp::utils::extract_observer_type_t<Observer>;
+
+    public:
+        join_within_disposable(Observer&& observer, Worker&& worker, const LeftKeySelector& left_key, const RightKeySelector& right_key, const Selector& selector, schedulers::duration window, size_t max_size_per_side)
+            : m_observer{std::move(observer)}
+            , m_worker{std::move(worker)}
+            , m_left_key{left_key}
+            , m_right_key{right_key}
+            , m_selector{selector}
+            , m_window{window}
+            , m_max_size_per_side{max_size_per_side}
+        {
+            if constexpr (!Worker::is_none_disposable)
+            {
+                if (auto d = m_worker.get_disposable(); !d.is_disposed())
+                    add(std::move(d));
+            }
+        }
+
+        void set_upstream_for_observer(const rpp::disposable_wrapper& d)
+        {
+            std::lock_guard lock{m_mutex};
+            m_observer.set_upstream(d);
+        }
+
+        template<size_t I, typename T>
+        void on_next(T&& v)
+        {
+            std::unique_lock lock{m_mutex};
+            // time obtained under lock to keep arrivals ordered
+            const auto now = m_worker.now();
+            if constexpr (I == 0)
+                on_next_impl(now, m_left_key(utils::as_const(v)), std::forward<T>(v), m_left, m_right, [&](const TRight& other) { return m_selector(utils::as_const(v), other); });
+            else
+                on_next_impl(now, m_right_key(utils::as_const(v)), std::forward<T>(v), m_right, m_left, [&](const TLeft& other) { return m_selector(other, utils::as_const(v)); });
+
+            const bool need_schedule_expiration = !std::exchange(m_expiration_scheduled, true);
+            if (!m_pending.empty() && !std::exchange(m_is_draining, true))
+                drain(lock);
+            else
+                lock.unlock();
+
+            // scheduled outside of lock due to worker can execute it immediately
+            if (need_schedule_expiration)
+                schedule_expiration(now + m_window);
+        }
+
+        void on_error(const std::exception_ptr& err)
+        {
+            dispose();
+
+            std::unique_lock lock{m_mutex};
+            // error cancels not emitted yet results
+            m_pending.clear();
+            if (std::exchange(m_is_draining, true))
+            {
+                if (!m_error)
+                    m_error = err;
+                return;
+            }
+            lock.unlock();
+            m_observer.on_error(err);
+        }
+
+        void on_completed()
+        {
+            std::unique_lock lock{m_mutex};
+            if (++m_completed_count != 2)
+                return;
+
+            // current emitter would complete observer after emission of staged results
+            if (std::exchange(m_is_draining, true))
+                return;
+            lock.unlock();
+
+            dispose();
+            m_observer.on_completed();
+        }
+
+    private:
+        template<typename TSelf, typename TOther, typename T, typename Fn>
+        void on_next_impl(schedulers::time_point now, TKey key, T&& v, TSelf& self, TOther& other, const Fn& select)
+        {
+            other.expire(now, m_window);
+            other.for_each_match(key, [&](const auto& other_value) { m_pending.push_back(select(other_value)); });
+
+            self.expire(now, m_window);
+            self.push(now, std::move(key), std::forward<T>(v), m_max_size_per_side);
+        }
+
+        /**
+         * @brief Emits staged results (and terminal event arrived during emission) outside of lock. Only one thread drains at any time, so, emissions are serialized.
+         */
+        void drain(std::unique_lock<std::mutex>& lock)
+        {
+            while (!m_pending.empty())
+            {
+                auto v = std::move(m_pending.front());
+                m_pending.pop_front();
+
+                lock.unlock();
+                if (!m_observer.is_disposed())
+                    m_observer.on_next(std::move(v));
+                lock.lock();
+            }
+
+            // keep "draining" state forever after termination to prevent any further emissions
+            if (m_error)
+            {
+                const auto err = m_error.value();
+                lock.unlock();
+                m_observer.on_error(err);
+                return;
+            }
+
+            if (m_completed_count == 2)
+            {
+                lock.unlock();
+                dispose();
+                m_observer.on_completed();
+                return;
+            }
+
+            m_is_draining = false;
+            lock.unlock();
+        }
+
+        /**
+         * @brief Drops expired values of both sides
+         * @return time when the next value expires if any value left
+         */
+        std::optional<schedulers::time_point> expire()
+        {
+            std::lock_guard lock{m_mutex};
+            const auto      now = m_worker.now();
+            m_left.expire(now, m_window);
+            m_right.expire(now, m_window);
+
+            const auto left  = m_left.oldest_arrival();
+            const auto right = m_right.oldest_arrival();
+            if (!left && !right)
+            {
+                m_expiration_scheduled = false;
+                return std::nullopt;
+            }
+            return std::min(left.value_or(schedulers::time_point::max()), right.value_or(schedulers::time_point::max())) + m_window;
+        }
+
+        void schedule_expiration(schedulers::time_point time)
+        {
+            using wrapper = join_within_disposable_wrapper<Observer, Worker, LeftKeySelector, RightKeySelector, Selector, TLeft, TRight>;
+            m_worker.schedule(
+                time,
+                [](const wrapper& handler) -> schedulers::optional_delay_to {
+                    if (const auto next = handler.disposable->expire())
+                        return schedulers::optional_delay_to{next.value()};
+                    return std::nullopt;
+                },
+                wrapper{this->wrapper_from_this().lock()});
+        }
+
+    private:
+        std::mutex                   m_mutex{};
+        Observer                     m_observer;
+        RPP_NO_UNIQUE_ADDRESS Worker m_worker;
+
+        RPP_NO_UNIQUE_ADDRESS LeftKeySelector  m_left_key;
+        RPP_NO_UNIQUE_ADDRESS RightKeySelector m_right_key;
+        RPP_NO_UNIQUE_ADDRESS Selector         m_selector;
+
+        schedulers::duration m_window;
+        size_t               m_max_size_per_side;
+
+        join_within_side<TKey, TLeft>     m_left{};
+        join_within_side<TKey, TRight>    m_right{};
+        std::deque<TResult>               m_pending{};
+        std::optional<std::exception_ptr> m_error{};
+        size_t                            m_completed_count{};
+        bool                              m_expiration_scheduled{};
+        bool                              m_is_draining{};
+    };
+
+    template<size_t I, typename Disposable>
+    struct join_within_observer_strategy
+    {
+        using preferred_disposable_strategy = rpp::details::observers::none_disposable_strategy;
+
+        std::shared_ptr<Disposable> disposable{};
+
+        void set_upstream(const rpp::disposable_wrapper& d) const { disposable->add(d); }
+
+        bool is_disposed() const { return disposable->is_disposed(); }
+
+        template<typename T>
+        void on_next(T&& v) const
+        {
+            disposable->template on_next<I>(std::forward<T>(v));
+        }
+
+        void on_error(const std::exception_ptr& err) const { disposable->on_error(err); }
+
+        void on_completed() const { disposable->on_completed(); }
+    };
+
+    template<rpp::constraint::observable TObservable, typename LeftKeySelector, typename RightKeySelector, typename Selector, rpp::schedulers::constraint::scheduler Scheduler>
+    struct join_within_t
+    {
+        using TRight = rpp::utils::extract_observable_type_t<TObservable>;
+
+        RPP_NO_UNIQUE_ADDRESS TObservable      other;
+        RPP_NO_UNIQUE_ADDRESS LeftKeySelector  left_key;
+        RPP_NO_UNIQUE_ADDRESS RightKeySelector right_key;
+        rpp::schedulers::duration              window;
+        RPP_NO_UNIQUE_ADDRESS Selector         selector;
+        RPP_NO_UNIQUE_ADDRESS Scheduler        scheduler;
+        size_t                                 max_size_per_side;
+
+        template<rpp::constraint::decayed_type T>
+        struct operator_traits
+        {
+            static_assert(std::invocable<LeftKeySelector, T>, "LeftKeySelector is not invocable with T");
+            static_assert(std::invocable<RightKeySelector, TRight>, "RightKeySelector is not invocable with type of other observable");
+            static_assert(std::same_as<rpp::utils::decayed_invoke_result_t<LeftKeySelector, T>, rpp::utils::decayed_invoke_result_t<RightKeySelector, TRight>>, "LeftKeySelector and RightKeySelector should return same type");
+            static_assert(rpp::constraint::hashable<rpp::utils::decayed_invoke_result_t<LeftKeySelector, T>>, "Result of KeySelector is not hashable");
+            static_assert(std::invocable<Selector, T, TRight>, "Selector is not invocable with T and type of other observable");
+
+            using result_type = rpp::utils::decayed_invoke_result_t<Selector, T, TRight>;
+        };
+
+        template<rpp::details::observables::constraint::disposable_strategy Prev>
+        using updated_disposable_strategy = rpp::details::observables::fixed_disposable_strategy_selector<1>;
+
+        template<rpp::constraint::observer Observer, typename... Strategies>
+        void subscribe(Observer&& observer, const observable_chain_strategy<Strategies...>& observable_strategy) const
+        {
+            using TLeft      = typename observable_chain_strategy<Strategies...>::value_type;
+            using worker_t   = rpp::schedulers::utils::get_worker_t<Scheduler>;
+            using Disposable = join_within_disposable<std::decay_t<Observer>, worker_t, LeftKeySelector, RightKeySelector, Selector, TLeft, TRight>;
+
+            // Need to take ownership over current_thread in case of other observable also using it
+            auto drain_on_exit = rpp::schedulers::current_thread::own_queue_and_drain_finally_if_not_owned();
+
+            const auto disposable = disposable_wrapper_impl<Disposable>::make(std::forward<Observer>(observer), scheduler.create_worker(), left_key, right_key, selector, window, max_size_per_side);
+            auto       ptr        = disposable.lock();
+            ptr->set_upstream_for_observer(disposable.as_weak());
+
+            other.subscribe(rpp::observer<TRight, join_within_observer_strategy<1, Disposable>>{ptr});
+            observable_strategy.subscribe(rpp::observer<TLeft, join_within_observer_strategy<0, Disposable>>{std::move(ptr)});
+        }
+    };
+} // namespace rpp::operators::details
+
+namespace rpp::operators
+{
+    /**
+     * @brief Joins emissions of current observable with emissions of other observable having same key and arrived within `window` of each other.
+     *
+     * @marble join_within
+       {
+           source observable                                     : +-1--    --2-----|
+           source other_observable                               : +---1    ------2-|
+           operator "join_within: x=>x, y=>y, 3, x,y=>{x,y}"     : +---{1,1}--------|
+       }
+     *
+     * @details Actually this operator keeps values of both observables arrived during last `window` inside hash index by key (one per side). Each new value is matched against stored values of other side with same key, selector is applied for each pair and result is emitted. Then value is stored for future values of other side.
+     * @details Values expire after `window` since their arrival: scheduler's worker drops expired values even if no any new emissions happen, so, state is released as soon as possible. In case of amount of stored values of any side reaches `max_size_per_side`, oldest value of this side is dropped.
+     * @details Operator completes when both observables completed, errors when any of them errors.
+     *
+     * @par Performance notes:
+     * - 1 heap allocation for disposable
+     * - each value copied/moved to internal storage; amortized O(1) lookup/insertion/expiration, no heap allocations per value after warm-up except of ones for new keys
+     * - mutex acquired for every emission of both observables to match it and to stage results, but observer is never called under lock
+     *
+     * @param other is observable whose emissions would be joined with emissions of current observable
+     * @param left_key is function which returns key for emission of current observable. Result of this function should be hashable.
+     * @param right_key is function which returns key for emission of other observable. Should return same type as `left_key`.
+     * @param window is maximal distance in time between arrival of joined values
+     * @param selector is function applied to matched pair of values (first is emission of current observable, second one is emission of other observable)
+     * @param scheduler is scheduler used to obtain time of arrival and to expire old values. Should be asynchronous one (like rpp::schedulers::new_thread or rpp::schedulers::run_loop) due to expiration is scheduled with delay.
+     * @param max_size_per_side is maximal amount of values stored for each side
+     *
+     * @warning #include <rpp/operators/join_within.hpp>
+     *
+     * @ingroup combining_operators
+     * @see https://reactivex.io/documentation/operators/join.html
+     */
+    template<rpp::constraint::observable TObservable, typename LeftKeySelector, typename RightKeySelector, typename Selector, rpp::schedulers::constraint::scheduler Scheduler>
+    auto join_within(TObservable&& other, LeftKeySelector&& left_key, RightKeySelector&& right_key, rpp::schedulers::duration window, Selector&& selector, Scheduler&& scheduler, size_t max_size_per_side)
+    {
+        return details::join_within_t<std::decay_t<TObservable>, std::decay_t<LeftKeySelector>, std::decay_t<RightKeySelector>, std::decay_t<Selector>, std::decay_t<Scheduler>>{std::forward<TObservable>(other),
+                                                                                                                                                                               std::forward<LeftKeySelector>(left_key),
+                                                                                                                                                                               std::forward<RightKeySelector>(right_key),
+                                                                                                                                                                               window,
+                                                                                                                                                                               std::forward<Selector>(selector),
+                                                                                                                                                                               std::forward<Scheduler>(scheduler),
+                                                                                                                                                                               max_size_per_side};
+    }
+
+    /**
+     * @brief Same as rpp::operators::join_within, but without limit for amount of stored values.
+     *
+     * @warning #include <rpp/operators/join_within.hpp>
+     *
+     * @ingroup combining_operators
+     * @see https://reactivex.io/documentation/operators/join.html
+     */
+    template<rpp::constraint::observable TObservable, typename LeftKeySelector, typename RightKeySelector, typename Selector, rpp::schedulers::constraint::scheduler Scheduler>
+    auto join_within(TObservable&& other, LeftKeySelector&& left_key, RightKeySelector&& right_key, rpp::schedulers::duration window, Selector&& selector, Scheduler&& scheduler)
+    {
+        return join_within(std::forward<TObservable>(other),
+                           std::forward<LeftKeySelector>(left_key),
+                           std::forward<RightKeySelector>(right_key),
+                           window,
+                           std::forward<Selector>(selector),
+                           std::forward<Scheduler>(scheduler),
+                           std::numeric_limits<size_t>::max());
+    }
+} // namespace rpp::operators
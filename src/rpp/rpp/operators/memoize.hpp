@@ -0,0 +1,305 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/operators/fwd.hpp>
+
+#include <rpp/defs.hpp>
+#include <rpp/observers/dynamic_observer.hpp>
+#include <rpp/operators/flat_map.hpp>
+#include <rpp/sources/create.hpp>
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+namespace rpp::operators::details
+{
+    /**
+     * @brief Result of single subscription shared among all requesters of the same key. Emissions are collected and replayed to each requester after termination, so, requesters are never called under lock and there is no any race between joining and emitting.
+     */
+    template<rpp::constraint::decayed_type Type>
+    class memoize_flight
+    {
+    public:
+        void subscribe(rpp::dynamic_observer<Type>&& observer)
+        {
+            {
+                std::lock_guard lock{m_mutex};
+                if (!m_is_terminated)
+                {
+                    m_waiters.push_back(std::move(observer));
+                    return;
+                }
+            }
+            // values are immutable after termination
+            replay(observer);
+        }
+
+        void on_next(const Type& v)
+        {
+            std::lock_guard lock{m_mutex};
+            m_values.push_back(v);
+        }
+
+        void on_error(const std::exception_ptr& err)
+        {
+            terminate([&] { m_error = err; });
+        }
+
+        void on_completed()
+        {
+            terminate([&] { m_completed_at = rpp::schedulers::clock_type::now(); });
+        }
+
+        /**
+         * @brief Flight can be shared with new requester if it is still in-flight or completed successfully not later than `ttl` ago
+         */
+        bool is_reusable(rpp::schedulers::time_point now, rpp::schedulers::duration ttl)
+        {
+            std::lock_guard lock{m_mutex};
+            if (!m_is_terminated)
+                return true;
+            return !m_error && now - m_completed_at < ttl;
+        }
+
+        bool is_terminated() const
+        {
+            std::lock_guard lock{m_mutex};
+            return m_is_terminated;
+        }
+
+    private:
+        template<typename Fn>
+        void terminate(Fn&& set_state)
+        {
+            std::vector<rpp::dynamic_observer<Type>> waiters{};
+            {
+                std::lock_guard lock{m_mutex};
+                set_state();
+                m_is_terminated = true;
+                std::swap(waiters, m_waiters);
+            }
+            for (const auto& observer : waiters)
+                replay(observer);
+        }
+
+        void replay(const rpp::dynamic_observer<Type>& observer) const
+        {
+            for (const auto& v : m_values)
+            {
+                if (observer.is_disposed())
+                    return;
+                observer.on_next(v);
+            }
+
+            if (m_error)
+                observer.on_error(m_error.value());
+            else
+                observer.on_completed();
+        }
+
+        mutable std::mutex                       m_mutex{};
+        std::vector<rpp::dynamic_observer<Type>> m_waiters{};
+        std::vector<Type>                        m_values{};
+        std::optional<std::exception_ptr>        m_error{};
+        rpp::schedulers::time_point              m_completed_at{};
+        bool                                     m_is_terminated{};
+    };
+
+    template<rpp::constraint::decayed_type Type>
+    struct memoize_flight_observer_strategy
+    {
+        using preferred_disposable_strategy = rpp::details::observers::none_disposable_strategy;
+
+        std::shared_ptr<memoize_flight<Type>> flight;
+
+        void set_upstream(const rpp::disposable_wrapper&) const {}
+
+        bool is_disposed() const { return flight->is_terminated(); }
+
+        void on_next(const Type& v) const { flight->on_next(v); }
+
+        void on_error(const std::exception_ptr& err) const { flight->on_error(err); }
+
+        void on_completed() const { flight->on_completed(); }
+    };
+
+    /**
+     * @brief LRU cache of flights: hit moves key to the front, insertion evicts key from the back when there are more than `capacity` keys.
+     */
+    template<rpp::constraint::hashable Key, rpp::constraint::decayed_type Type>
+    class memoize_cache
+    {
+    public:
+        memoize_cache(size_t capacity, rpp::schedulers::duration ttl)
+            : m_capacity{std::max(size_t{1}, capacity)}
+            , m_ttl{ttl}
+        {
+        }
+
+        /**
+         * @return flight for this key and flag if this flight is just created and requester should start it
+         */
+        std::pair<std::shared_ptr<memoize_flight<Type>>, bool> get_or_create(const Key& key)
+        {
+            const auto now = rpp::schedulers::clock_type::now();
+
+            std::lock_guard lock{m_mutex};
+            if (const auto itr = m_entries.find(key); itr != m_entries.end())
+            {
+                if (itr->second.flight->is_reusable(now, m_ttl))
+                {
+                    m_lru.splice(m_lru.begin(), m_lru, itr->second.position);
+                    return {itr->second.flight, false};
+                }
+                m_lru.erase(itr->second.position);
+                m_entries.erase(itr);
+            }
+
+            m_lru.push_front(key);
+            auto flight = std::make_shared<memoize_flight<Type>>();
+            m_entries.emplace(key, entry{flight, m_lru.begin()});
+            if (m_entries.size() > m_capacity)
+            {
+                m_entries.erase(m_lru.back());
+                m_lru.pop_back();
+            }
+            return {std::move(flight), true};
+        }
+
+    private:
+        struct entry
+        {
+            std::shared_ptr<memoize_flight<Type>> flight;
+            typename std::list<Key>::iterator     position;
+        };
+
+        std::mutex                      m_mutex{};
+        std::list<Key>                  m_lru{};
+        std::unordered_map<Key, entry>  m_entries{};
+        const size_t                    m_capacity;
+        const rpp::schedulers::duration m_ttl;
+    };
+
+    /**
+     * @brief Keeps caches shared among all observables operator is applied to. Type of cache depends on types of keys and values, so, cache is created lazily during first request of each such a type: generic `key_fn`/`fn` applied to streams of different types obtain different caches.
+     */
+    class memoize_state
+    {
+    public:
+        memoize_state(size_t capacity, rpp::schedulers::duration ttl)
+            : m_capacity{capacity}
+            , m_ttl{ttl}
+        {
+        }
+
+        template<typename Cache>
+        Cache& get_cache()
+        {
+            std::lock_guard lock{m_mutex};
+            auto&           cache = m_caches[std::type_index{typeid(Cache)}];
+            if (!cache)
+                cache = std::make_shared<Cache>(m_capacity, m_ttl);
+            // cache for this type_index is always created by this branch, so, its type is exactly Cache
+            return *static_cast<Cache*>(cache.get());
+        }
+
+    private:
+        std::mutex                                                 m_mutex{};
+        std::unordered_map<std::type_index, std::shared_ptr<void>> m_caches{};
+        size_t                                                     m_capacity;
+        rpp::schedulers::duration                                  m_ttl;
+    };
+
+    template<rpp::constraint::decayed_type T, typename KeyFn, typename Fn>
+    struct memoize_on_subscribe
+    {
+        using key_type    = rpp::utils::decayed_invoke_result_t<KeyFn, const T&>;
+        using result_type = rpp::utils::extract_observable_type_t<rpp::utils::decayed_invoke_result_t<Fn, const T&>>;
+        using cache_type  = memoize_cache<key_type, result_type>;
+
+        T                              value;
+        RPP_NO_UNIQUE_ADDRESS KeyFn    key_fn;
+        RPP_NO_UNIQUE_ADDRESS Fn       fn;
+        std::shared_ptr<memoize_state> state;
+
+        template<rpp::constraint::observer_of_type<result_type> TObserver>
+        void operator()(TObserver&& observer) const
+        {
+            auto&      cache               = state->get_cache<cache_type>();
+            const auto [flight, is_leader] = cache.get_or_create(key_fn(value));
+
+            flight->subscribe(std::forward<TObserver>(observer).as_dynamic());
+            // subscribe outside of cache's lock: observable can be synchronous and other requests can be issued from it
+            if (is_leader)
+                fn(value).subscribe(rpp::observer<result_type, memoize_flight_observer_strategy<result_type>>{flight});
+        }
+    };
+
+    template<typename KeyFn, typename Fn>
+    struct memoize_fn
+    {
+        RPP_NO_UNIQUE_ADDRESS KeyFn    key_fn;
+        RPP_NO_UNIQUE_ADDRESS Fn       fn;
+        std::shared_ptr<memoize_state> state;
+
+        template<typename T>
+        auto operator()(T&& v) const
+        {
+            using on_subscribe = memoize_on_subscribe<std::decay_t<T>, KeyFn, Fn>;
+            return rpp::source::create<typename on_subscribe::result_type>(on_subscribe{std::forward<T>(v), key_fn, fn, state});
+        }
+    };
+} // namespace rpp::operators::details
+
+namespace rpp::operators
+{
+    /**
+     * @brief Converts each emission into observable via `fn` (like rpp::operators::flat_map), but shares single subscription to observable among all concurrent requests with the same key and caches results of completed ones.
+     *
+     * @marble memoize
+         {
+             source observable                   : +-1-1--1-|
+             operator "memoize: x=>just(x*10)"   : +-(10)-(10)--(10)-|
+         }
+     *
+     * @details Operator keeps LRU cache of `capacity` keys (separate one for each type of key/result in case of generic `key_fn`/`fn`) shared among ALL observables this operator is applied to (copies of operator share the same cache too), so, it is intended to be created once and applied to all streams of requests.
+     * @details For each emission key is obtained via `key_fn`:
+     * - no entry for key (or entry is expired/failed) - observable is obtained via `fn` and subscribed, this request becomes "leader" of this key
+     * - entry for key is in-flight - request joins it without any additional subscription
+     * - entry for key is completed not later than `ttl` ago - request obtains cached result
+     * @details Emissions of shared observable are collected into small replay state and replayed to all requesters after its termination. Failed results are not cached: next request re-subscribes.
+     *
+     * @par Performance notes:
+     * - Heap allocation for each request and each new key (state of flight)
+     * - Mutex acquired to lookup key and to store/replay results, but requesters are never called under lock
+     * - Shared observable is not disposed when requesters are disposed: its result is still cached for next requests
+     *
+     * @param key_fn is function to obtain key of request. Keys should be hashable.
+     * @param fn is function to obtain observable for request (expensive lookup)
+     * @param capacity is maximal amount of cached keys
+     * @param ttl is duration of time result is cached after completion
+     *
+     * @warning #include <rpp/operators/memoize.hpp>
+     *
+     * @ingroup transforming_operators
+     */
+    template<typename KeyFn, typename Fn>
+    auto memoize(KeyFn&& key_fn, Fn&& fn, size_t capacity, rpp::schedulers::duration ttl)
+    {
+        return flat_map(details::memoize_fn<std::decay_t<KeyFn>, std::decay_t<Fn>>{std::forward<KeyFn>(key_fn), std::forward<Fn>(fn), std::make_shared<details::memoize_state>(capacity, ttl)});
+    }
+} // namespace rpp::operators
@@ -14,17 +14,20 @@
 
 #include <rpp/defs.hpp>
 #include <rpp/disposables/composite_disposable.hpp>
+#include <rpp/disposables/demand_disposable.hpp>
 #include <rpp/operators/details/strategy.hpp>
 #include <rpp/operators/details/utils.hpp>
 #include <rpp/schedulers/current_thread.hpp>
 #include <rpp/utils/tuple.hpp>
 
 #include <atomic>
+#include <memory>
 
 namespace rpp::operators::details
 {
-    template<rpp::constraint::observer TObserver>
+    template<rpp::constraint::observer TObserver, bool Padded = rpp::utils::pad_shared_states>
     class merge_disposable final : public composite_disposable
+        , public interface_demand
     {
     public:
         merge_disposable(TObserver&& observer)
@@ -40,9 +43,34 @@ namespace rpp::operators::details
 
         pointer_under_lock<TObserver> get_observer_under_lock() { return pointer_under_lock{m_observer}; }
 
+        // called by demand-aware downstream during subscription, so, before any inner subscription
+        void limit_demand(size_t initial) noexcept override { m_demand.limit(initial); }
+
+        void request(size_t n) noexcept override
+        {
+            if (m_demand.is_limited())
+                m_demand.request(n);
+        }
+
+        bool is_demand_limited() const { return m_demand.is_limited(); }
+
+        rpp::details::demand_distributor::inner_ptr add_inner_demand(const std::shared_ptr<interface_demand>& demand) { return m_demand.add_inner(demand); }
+
+        void remove_inner_demand(const rpp::details::demand_distributor::inner_ptr& inner) { m_demand.remove_inner(inner); }
+
+        void consume_demand(const rpp::details::demand_distributor::inner_ptr& inner)
+        {
+            if (m_demand.is_limited())
+                m_demand.consume(inner);
+        }
+
     private:
-        value_with_mutex<TObserver> m_observer{};
-        std::atomic_size_t          m_on_completed_needed{1};
+        rpp::details::demand_distributor m_demand{};
+
+        // inner observables usually emit from different threads: observer (locked for each emission) and counter (touched for each inner subscription/completion) are kept in their own cache lines apart from read-mostly fields
+        alignas(rpp::utils::cache_line_alignment_v<value_with_mutex<TObserver>, Padded>) value_with_mutex<TObserver> m_observer{};
+
+        alignas(rpp::utils::cache_line_alignment_v<std::atomic_size_t, Padded>) std::atomic_size_t m_on_completed_needed{1};
     };
 
     template<rpp::constraint::observer TObserver>
@@ -98,11 +126,36 @@ namespace rpp::operators::details
     {
         using merge_observer_base_strategy<TObserver>::merge_observer_base_strategy;
 
+        void set_upstream(const rpp::disposable_wrapper& d) const
+        {
+            merge_observer_base_strategy<TObserver>::set_upstream(d);
+
+            // outstanding demand of downstream is shared between demand-aware inner observables
+            if (m_demand || !merge_observer_base_strategy<TObserver>::m_disposable->is_demand_limited())
+                return;
+
+            if (const auto demand = rpp::details::get_demand(d))
+                m_demand = merge_observer_base_strategy<TObserver>::m_disposable->add_inner_demand(demand);
+        }
+
         template<typename T>
         void on_next(T&& v) const
         {
+            merge_observer_base_strategy<TObserver>::m_disposable->consume_demand(m_demand);
             merge_observer_base_strategy<TObserver>::m_disposable->get_observer_under_lock()->on_next(std::forward<T>(v));
         }
+
+        void on_completed() const
+        {
+            // return demand granted to this inner observable but not used by it
+            if (m_demand)
+                merge_observer_base_strategy<TObserver>::m_disposable->remove_inner_demand(m_demand);
+
+            merge_observer_base_strategy<TObserver>::on_completed();
+        }
+
+    private:
+        mutable rpp::details::demand_distributor::inner_ptr m_demand{};
     };
 
     template<rpp::constraint::observer TObserver>
@@ -218,6 +271,7 @@ namespace rpp::operators
      * @par Performance notes:
      * - 2 heap allocation (1 for state, 1 to convert observer to dynamic_observer)
      * - Acquiring mutex during all observer's calls
+     * - In case of demand-aware downstream (see rpp::operators::observe_on_bounded) outstanding demand is shared between demand-aware inner observables: each of them is requested for one item at a time, so, no more than requested items are emitted in total. Inner observable which holds requested item but doesn't emit it delays other ones until it emits or completes.
      *
      * @warning #include <rpp/operators/merge.hpp>
      *
@@ -251,6 +305,7 @@ namespace rpp::operators
      * @par Performance notes:
      * - 2 heap allocation (1 for state, 1 to convert observer to dynamic_observer)
      * - Acquiring mutex during all observer's calls
+     * - In case of demand-aware downstream (see rpp::operators::observe_on_bounded) outstanding demand is shared between demand-aware inner observables: each of them is requested for one item at a time, so, no more than requested items are emitted in total. Inner observable which holds requested item but doesn't emit it delays other ones until it emits or completes.
      *
      * @param observables are observables whose emissions would be merged with current observable
      * @warning #include <rpp/operators/merge.hpp>
@@ -0,0 +1,292 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/operators/fwd.hpp>
+
+#include <rpp/defs.hpp>
+#include <rpp/disposables/composite_disposable.hpp>
+#include <rpp/operators/details/strategy.hpp>
+#include <rpp/schedulers/current_thread.hpp>
+#include <rpp/utils/tuple.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <vector>
+
+namespace rpp::operators::details
+{
+    template<rpp::constraint::observable TObservable>
+    struct prioritized_observable
+    {
+        TObservable observable;
+        int         priority;
+    };
+
+    template<rpp::constraint::observer TObserver>
+    class merge_with_priority_disposable final : public composite_disposable
+    {
+        using T = rpp::utils::extract_observer_type_t<TObserver>;
+
+    public:
+        merge_with_priority_disposable(TObserver&& in_observer, const std::vector<int>& priorities, size_t max_queue_size)
+            : observer{std::move(in_observer)}
+            , m_queues(priorities.size())
+            , m_order(priorities.size())
+            , m_max_queue_size{max_queue_size}
+            , m_active_sources{priorities.size()}
+        {
+            std::iota(m_order.begin(), m_order.end(), size_t{});
+            std::stable_sort(m_order.begin(), m_order.end(), [&](size_t l, size_t r) { return priorities[l] > priorities[r]; });
+        }
+
+        template<typename TT>
+        void on_next(size_t source, TT&& v)
+        {
+            std::unique_lock lock{m_mutex};
+            // terminal event is emitted (or going to be emitted): any further emissions are dropped instead of being staged forever
+            if (m_is_terminated)
+                return;
+
+            if (m_is_draining)
+            {
+                // someone else is emitting right now: stage emission, current emitter would drain it according to priority
+                if (m_queues[source].size() < m_max_queue_size)
+                    m_queues[source].emplace_back(std::forward<TT>(v));
+                return;
+            }
+
+            // there is no emitter, so, all queues are empty and emission can be forwarded as is
+            m_is_draining = true;
+            lock.unlock();
+            observer.on_next(std::forward<TT>(v));
+            lock.lock();
+            drain(lock);
+        }
+
+        void on_error(const std::exception_ptr& err)
+        {
+            dispose();
+
+            std::unique_lock lock{m_mutex};
+            if (std::exchange(m_is_terminated, true))
+                return;
+
+            if (std::exchange(m_is_draining, true))
+            {
+                m_error = err;
+                return;
+            }
+            lock.unlock();
+            observer.on_error(err);
+        }
+
+        void on_completed()
+        {
+            {
+                std::lock_guard lock{m_mutex};
+                if (m_is_terminated || --m_active_sources != 0)
+                    return;
+
+                m_is_terminated = true;
+                if (std::exchange(m_is_draining, true))
+                    return;
+            }
+            dispose();
+            observer.on_completed();
+        }
+
+        TObserver observer;
+
+    private:
+        void drain(std::unique_lock<std::mutex>& lock)
+        {
+            while (true)
+            {
+                if (m_error)
+                {
+                    const auto err = m_error.value();
+                    for (auto& q : m_queues)
+                        q.clear();
+                    lock.unlock();
+                    observer.on_error(err);
+                    return;
+                }
+
+                const auto itr = std::find_if(m_order.cbegin(), m_order.cend(), [&](size_t source) { return !m_queues[source].empty(); });
+                if (itr == m_order.cend())
+                {
+                    // keep "draining" state forever after termination to prevent any further emissions
+                    if (m_active_sources != 0)
+                    {
+                        m_is_draining = false;
+                        return;
+                    }
+                    lock.unlock();
+                    dispose();
+                    observer.on_completed();
+                    return;
+                }
+
+                auto& queue = m_queues[*itr];
+                auto  v     = std::move(queue.front());
+                queue.pop_front();
+
+                lock.unlock();
+                observer.on_next(std::move(v));
+                lock.lock();
+            }
+        }
+
+        std::mutex                        m_mutex{};
+        std::vector<std::deque<T>>        m_queues;
+        std::vector<size_t>               m_order;
+        size_t                            m_max_queue_size;
+        size_t                            m_active_sources;
+        std::optional<std::exception_ptr> m_error{};
+        bool                              m_is_draining{};
+        bool                              m_is_terminated{};
+    };
+
+    template<rpp::constraint::observer TObserver>
+    struct merge_with_priority_observer_strategy
+    {
+        using preferred_disposable_strategy = rpp::details::observers::none_disposable_strategy;
+
+        std::shared_ptr<merge_with_priority_disposable<TObserver>> disposable{};
+        size_t                                                     source{};
+
+        void set_upstream(const rpp::disposable_wrapper& d) const { disposable->add(d); }
+
+        bool is_disposed() const { return disposable->is_disposed(); }
+
+        template<typename T>
+        void on_next(T&& v) const
+        {
+            disposable->on_next(source, std::forward<T>(v));
+        }
+
+        void on_error(const std::exception_ptr& err) const { disposable->on_error(err); }
+
+        void on_completed() const { disposable->on_completed(); }
+    };
+
+    template<rpp::constraint::observable... TObservables>
+    struct merge_with_priority_t
+    {
+        int                                                                             priority;
+        size_t                                                                          max_queue_size;
+        RPP_NO_UNIQUE_ADDRESS rpp::utils::tuple<prioritized_observable<TObservables>...> observables{};
+
+        template<rpp::constraint::decayed_type T>
+        struct operator_traits
+        {
+            static_assert((std::same_as<T, rpp::utils::extract_observable_type_t<TObservables>> && ...), "T is not same as values of other observables");
+
+            using result_type = T;
+        };
+
+        template<rpp::details::observables::constraint::disposable_strategy Prev>
+        using updated_disposable_strategy = rpp::details::observables::fixed_disposable_strategy_selector<1>;
+
+        template<rpp::constraint::observer Observer, typename... Strategies>
+        void subscribe(Observer&& observer, const observable_chain_strategy<Strategies...>& observable_strategy) const
+        {
+            using observer_t   = std::decay_t<Observer>;
+            using value_type   = rpp::utils::extract_observer_type_t<observer_t>;
+            using disposable_t = merge_with_priority_disposable<observer_t>;
+
+            const auto disposable = disposable_wrapper_impl<disposable_t>::make(std::forward<Observer>(observer), observables.apply(&collect_priorities, priority), max_queue_size);
+            const auto ptr        = disposable.lock();
+            ptr->observer.set_upstream(disposable.as_weak());
+
+            // Need to take ownership over current_thread in case of observables also using it
+            auto drain_on_exit = rpp::schedulers::current_thread::own_queue_and_drain_finally_if_not_owned();
+
+            observable_strategy.subscribe(rpp::observer<value_type, merge_with_priority_observer_strategy<observer_t>>{ptr, size_t{0}});
+            observables.apply(&subscribe_others<observer_t>, ptr);
+        }
+
+    private:
+        static std::vector<int> collect_priorities(int priority, const prioritized_observable<TObservables>&... observables)
+        {
+            return std::vector<int>{priority, observables.priority...};
+        }
+
+        template<rpp::constraint::observer Observer>
+        static void subscribe_others(const std::shared_ptr<merge_with_priority_disposable<Observer>>& disposable, const prioritized_observable<TObservables>&... observables)
+        {
+            using value_type = rpp::utils::extract_observer_type_t<Observer>;
+
+            size_t source{};
+            (observables.observable.subscribe(rpp::observer<value_type, merge_with_priority_observer_strategy<Observer>>{disposable, ++source}), ...);
+        }
+    };
+} // namespace rpp::operators::details
+
+namespace rpp::operators
+{
+    /**
+     * @brief Attaches priority to observable to be used with rpp::operators::merge_with_priority
+     *
+     * @param observable is observable to be merged
+     * @param priority is priority of emissions of this observable. Bigger value means higher priority.
+     *
+     * @warning #include <rpp/operators/merge_with_priority.hpp>
+     *
+     * @ingroup combining_operators
+     */
+    template<rpp::constraint::observable TObservable>
+    auto with_priority(TObservable&& observable, int priority)
+    {
+        return details::prioritized_observable<std::decay_t<TObservable>>{std::forward<TObservable>(observable), priority};
+    }
+
+    /**
+     * @brief Combines submissions from current observable with other observables into one, but emissions of observables with higher priority preempt emissions of observables with lower priority.
+     *
+     * @marble merge_with_priority
+         {
+             source original_observable (priority 0) : +-1-23-4-|
+             source second (priority 1)              : +---a-b--|
+             operator "merge_with_priority"          : +-1-2a3b4|
+         }
+     *
+     * @details Actually it works like rpp::operators::merge_with, but instead of waiting on mutex each emission arrived while other one is being emitted is staged into queue of its observable. Thread currently emitting emission drains such queues before returning: always from the queue of the observable with the highest priority first. As a result, emissions of high-priority observable (for example, control signals) are not starved by high-volume low-priority observables (for example, bulk data).
+     * @details Queue of each observable is bounded by `max_queue_size`: emissions arrived when queue is full are dropped. Observables with same priority are drained in order of passing to operator.
+     * @details Resulting observables completes when ALL observables completes. on_error is forwarded as soon as current emission is finished and drops all staged emissions.
+     *
+     * @par Performance notes:
+     * - 1 heap allocation for state
+     * - Acquiring mutex only to stage emissions/mark emitting, but not during observer's calls
+     * - Without contention emissions are forwarded as is without any queue
+     *
+     * @param priority is priority of emissions of current observable. Bigger value means higher priority.
+     * @param max_queue_size is maximal amount of staged emissions per observable
+     * @param observables are observables with priorities (see rpp::operators::with_priority) whose emissions would be merged with current observable
+     *
+     * @warning #include <rpp/operators/merge_with_priority.hpp>
+     *
+     * @par Example:
+     * @snippet merge.cpp merge_with_priority
+     *
+     * @ingroup combining_operators
+     * @see https://reactivex.io/documentation/operators/merge.html
+     */
+    template<rpp::constraint::observable... TObservables>
+    auto merge_with_priority(int priority, size_t max_queue_size, details::prioritized_observable<TObservables>... observables)
+    {
+        return details::merge_with_priority_t<TObservables...>{priority, max_queue_size, rpp::utils::tuple{std::move(observables)...}};
+    }
+} // namespace rpp::operators
@@ -28,6 +28,9 @@ namespace rpp::operators
      *
      * @details Actually this operator is just `delay`, but in case of obtaining `on_error` this operator cancels all scheduled but not emited emissions and forward error immediately. In case of you need to delay also `on_error`, use `delay` instead.
      *
+     * @par Performance notes:
+     * - In case of scheduler's worker is able to detect that emission happens inside its own execution context (for example, `rpp::schedulers::run_loop` while dispatching) and `delay_duration` is zero, emission is forwarded inline without extra scheduling. Recursion of such an inline executions is bounded: deep chains fall back to regular scheduling.
+     *
      * @param scheduler provides the threading model for delay. e.g. With a new thread scheduler, the observer sees the values in a new thread after a delay duration to the subscription.
      * @param delay_duration is the delay duration for emitting items. Delay duration should be able to cast to rpp::schedulers::duration.
      * @warning #include <rpp/operators/observe_on.hpp>
@@ -43,4 +46,25 @@ namespace rpp::operators
     {
         return details::delay_t<std::decay_t<Scheduler>, true>{delay_duration, std::forward<Scheduler>(scheduler)};
     }
+
+    /**
+     * @brief Same as rpp::operators::observe_on, but keeps no more than `max_queue_size` items scheduled but not emitted yet.
+     * @details Operator is demand-aware consumer of `request(n)` backpressure protocol: during subscription it limits demand-aware upstream (for example, rpp::source::from_iterable_on_demand, rpp::source::interval_on_demand, rpp::source::create_on_demand or merge/concat of such observables) to `max_queue_size` items and requests one more item each time when item is emitted to downstream. So, fast producer can't overflow queue of slow consumer and no items are dropped.
+     * @details Demand is propagated only through adjacent demand-aware operators: in case of any other operator between them (or upstream which is not demand-aware) operator behaves like regular rpp::operators::observe_on with unbounded queue.
+     *
+     * @par Performance notes:
+     * - Additional atomic operations to request one more item for each emission
+     *
+     * @param scheduler provides the threading model for emissions.
+     * @param max_queue_size is maximal amount of items scheduled but not emitted yet. Zero means unbounded queue.
+     * @warning #include <rpp/operators/observe_on.hpp>
+     *
+     * @ingroup utility_operators
+     * @see https://reactivex.io/documentation/operators/backpressure.html
+     */
+    template<rpp::schedulers::constraint::scheduler Scheduler>
+    auto observe_on_bounded(Scheduler&& scheduler, size_t max_queue_size)
+    {
+        return details::delay_t<std::decay_t<Scheduler>, true>{{}, std::forward<Scheduler>(scheduler), max_queue_size};
+    }
 } // namespace rpp::operators
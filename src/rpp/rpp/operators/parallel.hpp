@@ -0,0 +1,593 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/operators/fwd.hpp>
+
+#include <rpp/defs.hpp>
+#include <rpp/disposables/composite_disposable.hpp>
+#include <rpp/disposables/refcount_disposable.hpp>
+#include <rpp/observables/grouped_observable.hpp>
+#include <rpp/observers/dynamic_observer.hpp>
+#include <rpp/operators/details/strategy.hpp>
+#include <rpp/operators/merge.hpp>
+#include <rpp/schedulers/current_thread.hpp>
+#include <rpp/utils/exceptions.hpp>
+#include <rpp/utils/spsc_queue.hpp>
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace rpp::operators::details
+{
+    template<rpp::constraint::decayed_type T, typename Worker>
+    class parallel_rail;
+
+    template<rpp::constraint::decayed_type T, typename Worker>
+    struct parallel_rail_handler
+    {
+        std::shared_ptr<parallel_rail<T, Worker>> rail{};
+
+        bool is_disposed() const { return rail->is_disposed(); }
+
+        void on_error(const std::exception_ptr& err) const { rail->get_observer().on_error(err); }
+    };
+
+    /**
+     * @brief State of single rail: emissions are handed off from thread of original observable to worker of rail via lock-free queue.
+     * @details `m_pending` counts emissions (and terminal event) pushed but not processed yet plus one extra token meaning "not subscribed yet". Thread moving it from zero schedules drain, so, there is no more than one drain at any time and it keeps draining till counter drops back to zero.
+     */
+    template<rpp::constraint::decayed_type T, typename Worker>
+    class parallel_rail final : public std::enable_shared_from_this<parallel_rail<T, Worker>>
+    {
+    public:
+        explicit parallel_rail(Worker&& worker)
+            : m_worker{std::move(worker)}
+        {
+        }
+
+        template<typename TT>
+        void push(TT&& v)
+        {
+            // nobody would pop it anymore
+            if (is_disposed())
+                return;
+
+            m_queue.push(std::forward<TT>(v));
+            signal();
+        }
+
+        void terminate(std::optional<std::exception_ptr> err)
+        {
+            // published to drain via release of counter
+            m_error = std::move(err);
+            signal();
+        }
+
+        void subscribe(rpp::dynamic_observer<T>&& observer, const rpp::composite_disposable_wrapper& disposable)
+        {
+            if (m_is_subscribed.exchange(true, std::memory_order::relaxed))
+            {
+                observer.on_error(std::make_exception_ptr(rpp::utils::already_subscribed{"rail of rpp::operators::parallel can be subscribed only once"}));
+                return;
+            }
+
+            if constexpr (!Worker::is_none_disposable)
+            {
+                if (auto d = m_worker.get_disposable(); !d.is_disposed())
+                    disposable.add(std::move(d));
+            }
+
+            m_observer.emplace(std::move(observer));
+            // release "not subscribed" token: emissions pushed before subscription have to be drained right now
+            if (m_pending.fetch_sub(1, std::memory_order::acq_rel) != 1)
+                schedule_drain();
+        }
+
+        bool is_disposed() const { return m_is_disposed.load(std::memory_order::relaxed); }
+
+        const rpp::dynamic_observer<T>& get_observer() const { return m_observer.value(); }
+
+        void drain()
+        {
+            auto count = m_pending.load(std::memory_order::acquire);
+            while (true)
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    if (m_observer->is_disposed())
+                    {
+                        // keep counter non-zero forever: nobody would schedule drain anymore
+                        m_is_disposed.store(true, std::memory_order::relaxed);
+                        return;
+                    }
+
+                    // terminal event is always the last one token
+                    auto v = m_queue.pop();
+                    if (!v)
+                    {
+                        if (m_error)
+                            m_observer->on_error(m_error.value());
+                        else
+                            m_observer->on_completed();
+                        return;
+                    }
+                    m_observer->on_next(std::move(v).value());
+                }
+
+                const auto prev = m_pending.fetch_sub(count, std::memory_order::acq_rel);
+                if (prev == count)
+                    return;
+                count = prev - count;
+            }
+        }
+
+    private:
+        void signal()
+        {
+            if (m_pending.fetch_add(1, std::memory_order::acq_rel) == 0)
+                schedule_drain();
+        }
+
+        void schedule_drain()
+        {
+            m_worker.schedule(
+                [](const parallel_rail_handler<T, Worker>& handler) -> rpp::schedulers::optional_delay_from_now {
+                    handler.rail->drain();
+                    return std::nullopt;
+                },
+                parallel_rail_handler<T, Worker>{this->shared_from_this()});
+        }
+
+        rpp::utils::spsc_queue<T>               m_queue{};
+        std::atomic<size_t>                     m_pending{1};
+        std::atomic_bool                        m_is_subscribed{};
+        std::atomic_bool                        m_is_disposed{};
+        std::optional<rpp::dynamic_observer<T>> m_observer{};
+        std::optional<std::exception_ptr>       m_error{};
+        RPP_NO_UNIQUE_ADDRESS Worker            m_worker;
+    };
+
+    template<rpp::constraint::decayed_type T, typename Worker>
+    struct parallel_rail_observable_strategy
+    {
+        using value_type = T;
+
+        std::shared_ptr<parallel_rail<T, Worker>> rail;
+        std::weak_ptr<refcount_disposable>        disposable;
+
+        template<rpp::constraint::observer_strategy<T> Strategy>
+        void subscribe(observer<T, Strategy>&& obs) const
+        {
+            if (const auto locked = disposable.lock())
+            {
+                auto d = locked->add_ref();
+                obs.set_upstream(d);
+                rail->subscribe(std::move(obs).as_dynamic(), d);
+            }
+        }
+    };
+
+    struct parallel_round_robin
+    {
+        mutable size_t next{};
+
+        template<typename T>
+        size_t operator()(const T&, size_t rails) const
+        {
+            const auto rail = next;
+            next            = next + 1 == rails ? 0 : next + 1;
+            return rail;
+        }
+    };
+
+    template<rpp::constraint::decayed_type KeySelector>
+    struct parallel_by_key
+    {
+        RPP_NO_UNIQUE_ADDRESS KeySelector key_selector;
+
+        template<typename T>
+        size_t operator()(const T& v, size_t rails) const
+        {
+            using key_type = rpp::utils::decayed_invoke_result_t<KeySelector, const T&>;
+            return std::hash<key_type>{}(key_selector(v)) % rails;
+        }
+    };
+
+    template<rpp::constraint::decayed_type T, rpp::constraint::observer TObserver, typename Worker, rpp::constraint::decayed_type Partitioner>
+    struct parallel_observer_strategy
+    {
+        using preferred_disposable_strategy = rpp::details::observers::none_disposable_strategy;
+
+        using rail_t = parallel_rail<T, Worker>;
+
+        template<typename Scheduler>
+        parallel_observer_strategy(TObserver&& in_observer, size_t rails_count, const Scheduler& scheduler, const Partitioner& in_partitioner)
+            : observer{std::move(in_observer)}
+            , partitioner{in_partitioner}
+        {
+            observer.set_upstream(disposable->add_ref());
+
+            // all rails are known in advance, so, emit them before any emission to let downstream subscribe them
+            rails.reserve(std::max(size_t{1}, rails_count));
+            for (size_t i = 0; i < rails.capacity(); ++i)
+            {
+                const auto& rail = rails.emplace_back(std::make_shared<rail_t>(scheduler.create_worker()));
+                observer.on_next(rpp::grouped_observable<size_t, T, parallel_rail_observable_strategy<T, Worker>>{i, parallel_rail_observable_strategy<T, Worker>{rail, disposable}});
+            }
+        }
+
+        RPP_NO_UNIQUE_ADDRESS TObserver      observer;
+        RPP_NO_UNIQUE_ADDRESS Partitioner    partitioner;
+        std::shared_ptr<refcount_disposable> disposable = disposable_wrapper_impl<refcount_disposable>::make().lock();
+        std::vector<std::shared_ptr<rail_t>> rails{};
+
+        void set_upstream(const rpp::disposable_wrapper& d) const { disposable->add(d); }
+
+        bool is_disposed() const { return disposable->is_disposed(); }
+
+        template<typename TT>
+        void on_next(TT&& v) const
+        {
+            rails[partitioner(rpp::utils::as_const(v), rails.size())]->push(std::forward<TT>(v));
+        }
+
+        void on_error(const std::exception_ptr& err) const
+        {
+            for (const auto& rail : rails)
+                rail->terminate(err);
+
+            observer.on_error(err);
+        }
+
+        void on_completed() const
+        {
+            for (const auto& rail : rails)
+                rail->terminate(std::nullopt);
+
+            observer.on_completed();
+        }
+    };
+
+    template<rpp::schedulers::constraint::scheduler Scheduler, rpp::constraint::decayed_type Partitioner>
+    struct parallel_t
+    {
+        using worker_t = rpp::schedulers::utils::get_worker_t<Scheduler>;
+
+        template<rpp::constraint::decayed_type T>
+        struct operator_traits
+        {
+            using result_type = rpp::grouped_observable<size_t, T, parallel_rail_observable_strategy<T, worker_t>>;
+        };
+
+        template<rpp::details::observables::constraint::disposable_strategy Prev>
+        using updated_disposable_strategy = rpp::details::observables::fixed_disposable_strategy_selector<1>;
+
+        size_t                            rails;
+        RPP_NO_UNIQUE_ADDRESS Scheduler   scheduler;
+        RPP_NO_UNIQUE_ADDRESS Partitioner partitioner;
+
+        template<rpp::constraint::decayed_type Type, rpp::constraint::observer Observer>
+        auto lift(Observer&& observer) const
+        {
+            using strategy = parallel_observer_strategy<Type, std::decay_t<Observer>, worker_t, Partitioner>;
+            return rpp::observer<Type, strategy>{std::forward<Observer>(observer), rails, scheduler, partitioner};
+        }
+    };
+
+    template<rpp::constraint::observer TObserver>
+    class sequential_ordered_disposable final : public composite_disposable
+    {
+        using T = rpp::utils::extract_observer_type_t<TObserver>;
+
+    public:
+        explicit sequential_ordered_disposable(TObserver&& in_observer)
+            : observer{std::move(in_observer)}
+        {
+        }
+
+        size_t add_inner()
+        {
+            std::lock_guard lock{m_mutex};
+            m_queues.emplace_back();
+            m_completed.push_back(false);
+            ++m_active;
+            return m_queues.size() - 1;
+        }
+
+        template<typename TT>
+        void on_next(size_t inner, TT&& v)
+        {
+            std::unique_lock lock{m_mutex};
+            if (m_is_draining || inner != m_turn || !m_queues[inner].empty())
+            {
+                m_queues[inner].emplace_back(std::forward<TT>(v));
+                if (m_is_draining)
+                    return;
+
+                m_is_draining = true;
+                drain(lock);
+                return;
+            }
+
+            // it is turn of this inner observable and there is nothing staged: emission can be forwarded as is
+            m_is_draining = true;
+            advance_turn();
+            lock.unlock();
+            observer.on_next(std::forward<TT>(v));
+            lock.lock();
+            drain(lock);
+        }
+
+        void on_error(const std::exception_ptr& err)
+        {
+            dispose();
+
+            std::unique_lock lock{m_mutex};
+            if (std::exchange(m_is_draining, true))
+            {
+                if (!m_error)
+                    m_error = err;
+                return;
+            }
+            lock.unlock();
+            observer.on_error(err);
+        }
+
+        void on_completed(std::optional<size_t> inner)
+        {
+            std::unique_lock lock{m_mutex};
+            if (inner)
+                m_completed[inner.value()] = true;
+            --m_active;
+            if (std::exchange(m_is_draining, true))
+                return;
+            drain(lock);
+        }
+
+        TObserver observer;
+
+    private:
+        void advance_turn() { m_turn = m_turn + 1 == m_queues.size() ? 0 : m_turn + 1; }
+
+        void drain(std::unique_lock<std::mutex>& lock)
+        {
+            while (true)
+            {
+                if (m_error)
+                {
+                    const auto err = m_error.value();
+                    m_queues.clear();
+                    lock.unlock();
+                    observer.on_error(err);
+                    return;
+                }
+
+                // completed inner observables without staged emissions are just skipped
+                for (size_t skipped = 0; skipped < m_queues.size() && m_completed[m_turn] && m_queues[m_turn].empty(); ++skipped)
+                    advance_turn();
+
+                if (m_queues.empty() || m_queues[m_turn].empty())
+                {
+                    // keep "draining" state forever after termination to prevent any further emissions
+                    if (m_active != 0)
+                    {
+                        m_is_draining = false;
+                        return;
+                    }
+                    lock.unlock();
+                    dispose();
+                    observer.on_completed();
+                    return;
+                }
+
+                auto& queue = m_queues[m_turn];
+                auto  v     = std::move(queue.front());
+                queue.pop_front();
+                advance_turn();
+
+                lock.unlock();
+                observer.on_next(std::move(v));
+                lock.lock();
+            }
+        }
+
+        std::mutex                        m_mutex{};
+        std::vector<std::deque<T>>        m_queues{};
+        std::vector<bool>                 m_completed{};
+        size_t                            m_turn{};
+        size_t                            m_active{1};
+        std::optional<std::exception_ptr> m_error{};
+        bool                              m_is_draining{};
+    };
+
+    template<rpp::constraint::observer TObserver>
+    struct sequential_ordered_inner_observer_strategy
+    {
+        using preferred_disposable_strategy = rpp::details::observers::none_disposable_strategy;
+
+        std::shared_ptr<sequential_ordered_disposable<TObserver>> disposable{};
+        size_t                                                    inner{};
+
+        void set_upstream(const rpp::disposable_wrapper& d) const { disposable->add(d); }
+
+        bool is_disposed() const { return disposable->is_disposed(); }
+
+        template<typename T>
+        void on_next(T&& v) const
+        {
+            disposable->on_next(inner, std::forward<T>(v));
+        }
+
+        void on_error(const std::exception_ptr& err) const { disposable->on_error(err); }
+
+        void on_completed() const { disposable->on_completed(inner); }
+    };
+
+    template<rpp::constraint::observer TObserver>
+    struct sequential_ordered_observer_strategy
+    {
+        using preferred_disposable_strategy = rpp::details::observers::none_disposable_strategy;
+
+        std::shared_ptr<sequential_ordered_disposable<TObserver>> disposable{};
+
+        void set_upstream(const rpp::disposable_wrapper& d) const { disposable->add(d); }
+
+        bool is_disposed() const { return disposable->is_disposed(); }
+
+        template<typename TObservable>
+        void on_next(TObservable&& observable) const
+        {
+            using value_type = rpp::utils::extract_observer_type_t<TObserver>;
+
+            std::forward<TObservable>(observable).subscribe(rpp::observer<value_type, sequential_ordered_inner_observer_strategy<TObserver>>{disposable, disposable->add_inner()});
+        }
+
+        void on_error(const std::exception_ptr& err) const { disposable->on_error(err); }
+
+        void on_completed() const { disposable->on_completed(std::nullopt); }
+    };
+
+    struct sequential_ordered_t
+    {
+        template<rpp::constraint::decayed_type T>
+        struct operator_traits
+        {
+            static_assert(rpp::constraint::observable<T>, "T is not observable");
+
+            using result_type = rpp::utils::extract_observable_type_t<T>;
+        };
+
+        template<rpp::details::observables::constraint::disposable_strategy Prev>
+        using updated_disposable_strategy = rpp::details::observables::fixed_disposable_strategy_selector<1>;
+
+        template<rpp::constraint::observer Observer, typename... Strategies>
+        void subscribe(Observer&& observer, const observable_chain_strategy<Strategies...>& strategy) const
+        {
+            using observer_t      = std::decay_t<Observer>;
+            using InnerObservable = typename observable_chain_strategy<Strategies...>::value_type;
+
+            const auto disposable = disposable_wrapper_impl<sequential_ordered_disposable<observer_t>>::make(std::forward<Observer>(observer));
+            auto       ptr        = disposable.lock();
+            ptr->observer.set_upstream(disposable.as_weak());
+
+            // Need to take ownership over current_thread in case of inner-observables also using it
+            auto drain_on_exit = rpp::schedulers::current_thread::own_queue_and_drain_finally_if_not_owned();
+
+            strategy.subscribe(rpp::observer<InnerObservable, sequential_ordered_observer_strategy<observer_t>>{std::move(ptr)});
+        }
+    };
+} // namespace rpp::operators::details
+
+namespace rpp::operators
+{
+    /**
+     * @brief Splits original observable into `rails` observables ("rails") processed in parallel: emissions are distributed among rails in round-robin manner and each rail emits its emissions via its own worker of provided scheduler.
+     *
+     * @marble parallel
+        {
+             source observable      : +-1-2-3-4-|
+             operator "parallel(2)" :
+             {
+                                      .+-1---3---|
+                                      .+---2---4-|
+             }
+        }
+     *
+     * @details Resulting observable emits all rails (as rpp::grouped_observable with index of rail as key) immediately during subscription, before any emission of original observable, and completes after completion of original observable. Any ordinary chain of operators (map, filter, scan and etc) can be applied to each rail and it would be executed on worker of this rail. Use rpp::operators::sequential or rpp::operators::sequential_ordered to join rails back into one observable.
+     * @details Each rail has its own worker obtained via `scheduler.create_worker()`. Emissions are handed off from thread of original observable to worker of rail via unbounded lock-free single-producer/single-consumer queue: producer never waits for consumer and worker is scheduled only when rail transitions from idle to busy, so, scheduler is not touched per emission under load.
+     * @details Emissions pushed before subscription to rail are kept and emitted after subscription. Each rail can be subscribed only once: further subscriptions receive on_error with rpp::utils::already_subscribed.
+     *
+     * @par Performance notes:
+     * - 1 heap allocation per rail + 1 heap allocation per 256 emissions of rail (chunk of queue)
+     * - No any locks: 1 atomic increment per emission at producer side, consumer drains all emissions available at once
+     * - Each emission is moved/copied into queue
+     *
+     * @param rails is amount of rails (minimum 1)
+     * @param scheduler is scheduler used to create worker for each rail. Use scheduler with real concurrency (for example, rpp::schedulers::new_thread) to process rails in parallel.
+     *
+     * @warning #include <rpp/operators/parallel.hpp>
+     *
+     * @ingroup utility_operators
+     */
+    template<rpp::schedulers::constraint::scheduler Scheduler>
+    auto parallel(size_t rails, Scheduler&& scheduler)
+    {
+        return details::parallel_t<std::decay_t<Scheduler>, details::parallel_round_robin>{rails, std::forward<Scheduler>(scheduler), details::parallel_round_robin{}};
+    }
+
+    /**
+     * @brief Same as rpp::operators::parallel, but emissions are distributed among rails by hash of key obtained via `key_selector`: emissions with the same key always go to the same rail, so, per-key state (for example, rpp::operators::scan_by_key) can be kept inside rail without any synchronization.
+     *
+     * @param rails is amount of rails (minimum 1)
+     * @param scheduler is scheduler used to create worker for each rail
+     * @param key_selector is function to obtain key of emission. Keys should be hashable.
+     *
+     * @warning #include <rpp/operators/parallel.hpp>
+     *
+     * @ingroup utility_operators
+     */
+    template<rpp::schedulers::constraint::scheduler Scheduler, typename KeySelector>
+        requires (!utils::is_not_template_callable<KeySelector> || !std::same_as<void, std::invoke_result_t<KeySelector, rpp::utils::convertible_to_any>>)
+    auto parallel(size_t rails, Scheduler&& scheduler, KeySelector&& key_selector)
+    {
+        using partitioner = details::parallel_by_key<std::decay_t<KeySelector>>;
+        return details::parallel_t<std::decay_t<Scheduler>, partitioner>{rails, std::forward<Scheduler>(scheduler), partitioner{std::forward<KeySelector>(key_selector)}};
+    }
+
+    /**
+     * @brief Joins rails of rpp::operators::parallel back into one observable. Emissions are emitted as soon as they arrive from any rail, so, original order is not preserved.
+     *
+     * @details Actually it is just rpp::operators::merge: emissions of rails are serialized via mutex.
+     *
+     * @warning #include <rpp/operators/parallel.hpp>
+     *
+     * @ingroup utility_operators
+     */
+    inline auto sequential()
+    {
+        return merge();
+    }
+
+    /**
+     * @brief Joins rails of rpp::operators::parallel back into one observable restoring order of round-robin distribution: emissions are taken from rails in turn (first emission of first rail, first emission of second rail and so on).
+     *
+     * @marble sequential_ordered
+         {
+             source observable             :
+             {
+                 +-1-----3-|
+                 +--2-4----|
+             }
+             operator "sequential_ordered" : +-1-2-----(34)|
+         }
+     *
+     * @details Order of original observable is restored only when rails are obtained via round-robin rpp::operators::parallel and each rail emits exactly one emission per received emission (map, tap, scan and etc). Filtering or multiplying emissions inside rail breaks turn order, but no emissions are lost. Rails completed without staged emissions are skipped.
+     * @details Emissions arrived out of turn are staged in unbounded queue of their rail till their turn.
+     *
+     * @par Performance notes:
+     * - 1 heap allocation for state
+     * - Acquiring mutex only to stage emissions/mark emitting, but not during observer's calls
+     * - Emission arrived in its turn while nothing is staged is forwarded as is without any queue
+     *
+     * @warning #include <rpp/operators/parallel.hpp>
+     *
+     * @ingroup utility_operators
+     */
+    inline auto sequential_ordered()
+    {
+        return details::sequential_ordered_t{};
+    }
+} // namespace rpp::operators
@@ -0,0 +1,83 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/operators/fwd.hpp>
+
+#include <rpp/operators/details/sketch_strategy.hpp>
+#include <rpp/utils/sketches.hpp>
+
+namespace rpp::operators::details
+{
+    struct quantiles_policy
+    {
+        std::vector<double> ranks;
+        size_t              k;
+
+        template<rpp::constraint::decayed_type T>
+        rpp::utils::quantile_sketch<T> make() const
+        {
+            return rpp::utils::quantile_sketch<T>{k};
+        }
+
+        template<rpp::constraint::decayed_type T>
+        std::vector<T> result(const rpp::utils::quantile_sketch<T>& sketch) const
+        {
+            return sketch.quantiles(ranks);
+        }
+    };
+} // namespace rpp::operators::details
+
+namespace rpp::operators
+{
+    /**
+     * @brief Emits approximate quantiles of values emitted by observable (as `std::vector<T>` in the same order as requested ranks) when it completes.
+     *
+     * @marble quantiles
+     {
+         source observable              : +--1-5-2-4-3-|
+         operator "quantiles({0.5, 1})" : +------------{3,5}|
+     }
+     *
+     * @details Actually this operator keeps KLL-like sketch: hierarchy of compactors of `k` values each. When compactor is full, it is sorted and half of values is promoted to next level with doubled weight. So, memory is O(k * log(n/k)) and rank error is O(log(n/k) / k). Result is exact while amount of values is less than `k`.
+     * @details Can be used as per-window aggregate too: `window(...) | flat_map([](auto w) { return w | quantiles({0.5, 0.99}); })`
+     * @details Emits empty vector in case of no any emissions.
+     *
+     * @par Performance notes:
+     * - No heap allocations after compactors are warmed up
+     * - amortized O(log k) for each emission due to sorting of compactors
+     *
+     * @param ranks are normalized ranks in range [0;1] (0.5 - median, 0.99 - 99th percentile)
+     * @param k is capacity of each compactor. Greater `k` gives better precision.
+     *
+     * @warning #include <rpp/operators/quantiles.hpp>
+     *
+     * @ingroup aggregate_operators
+     */
+    inline auto quantiles(std::vector<double> ranks, size_t k)
+    {
+        return details::sketch_t<details::quantiles_policy>{details::quantiles_policy{std::move(ranks), k}};
+    }
+
+    /**
+     * @brief Same as rpp::operators::quantiles, but with compactors of 256 values.
+     *
+     * @param ranks are normalized ranks in range [0;1] (0.5 - median, 0.99 - 99th percentile)
+     *
+     * @warning #include <rpp/operators/quantiles.hpp>
+     *
+     * @ingroup aggregate_operators
+     */
+    inline auto quantiles(std::vector<double> ranks)
+    {
+        return quantiles(std::move(ranks), 256);
+    }
+} // namespace rpp::operators
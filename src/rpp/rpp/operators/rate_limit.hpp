@@ -0,0 +1,387 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/operators/fwd.hpp>
+
+#include <rpp/defs.hpp>
+#include <rpp/disposables/composite_disposable.hpp>
+#include <rpp/disposables/demand_disposable.hpp>
+#include <rpp/operators/details/strategy.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <optional>
+
+namespace rpp::operators::rate_limit_policy
+{
+    /**
+     * @brief Emissions exceeding rate are dropped
+     */
+    struct drop
+    {
+    };
+
+    /**
+     * @brief Emissions exceeding rate are queued and emitted via scheduler as soon as rate allows. Emissions arrived when queue is full are dropped.
+     */
+    struct delay
+    {
+        size_t max_queue_size;
+    };
+} // namespace rpp::operators::rate_limit_policy
+
+namespace rpp::operators::details
+{
+    /**
+     * @brief Token bucket in form of GCRA (generic cell rate algorithm): whole state is single "theoretical arrival time", tokens are refilled lazily by comparing it with current time.
+     */
+    struct token_bucket
+    {
+        token_bucket(rpp::schedulers::duration interval, size_t burst)
+            : interval{interval}
+            , tolerance{interval * static_cast<rpp::schedulers::duration::rep>(std::max<size_t>(burst, 1) - 1)}
+        {
+        }
+
+        bool try_acquire(rpp::schedulers::time_point now)
+        {
+            const auto tat = std::max(theoretical_arrival_time, now);
+            if (tat - now > tolerance)
+                return false;
+
+            theoretical_arrival_time = tat + interval;
+            return true;
+        }
+
+        rpp::schedulers::time_point available_at() const { return theoretical_arrival_time - tolerance; }
+
+        rpp::schedulers::duration   interval;
+        rpp::schedulers::duration   tolerance;
+        rpp::schedulers::time_point theoretical_arrival_time{};
+    };
+
+    template<rpp::constraint::observer TObserver, typename Worker>
+    struct rate_limit_drop_observer_strategy
+    {
+        using preferred_disposable_strategy = rpp::details::observers::none_disposable_strategy;
+
+        RPP_NO_UNIQUE_ADDRESS TObserver observer;
+        mutable token_bucket            bucket;
+
+        template<typename T>
+        void on_next(T&& v) const
+        {
+            if (bucket.try_acquire(Worker::now()))
+                observer.on_next(std::forward<T>(v));
+        }
+
+        void on_error(const std::exception_ptr& err) const { observer.on_error(err); }
+
+        void on_completed() const { observer.on_completed(); }
+
+        void set_upstream(const disposable_wrapper& d) { observer.set_upstream(rpp::details::hide_demand(d)); }
+
+        bool is_disposed() const { return observer.is_disposed(); }
+    };
+
+    template<rpp::schedulers::constraint::scheduler Scheduler>
+    struct rate_limit_drop_t : lift_operator<rate_limit_drop_t<Scheduler>, token_bucket>
+    {
+        using operators::details::lift_operator<rate_limit_drop_t<Scheduler>, token_bucket>::lift_operator;
+
+        template<rpp::constraint::decayed_type T>
+        struct operator_traits
+        {
+            using result_type = T;
+
+            template<rpp::constraint::observer_of_type<result_type> TObserver>
+            using observer_strategy = rate_limit_drop_observer_strategy<TObserver, rpp::schedulers::utils::get_worker_t<Scheduler>>;
+        };
+
+        template<rpp::details::observables::constraint::disposable_strategy Prev>
+        using updated_disposable_strategy = Prev;
+    };
+
+    template<rpp::constraint::observer Observer, typename Worker, rpp::details::disposables::constraint::disposable_container Container>
+    class rate_limit_disposable;
+
+    template<rpp::constraint::observer Observer, typename Worker, rpp::details::disposables::constraint::disposable_container Container>
+    struct rate_limit_disposable_wrapper
+    {
+        std::shared_ptr<rate_limit_disposable<Observer, Worker, Container>> disposable{};
+
+        bool is_disposed() const { return disposable->is_disposed(); }
+
+        void on_error(const std::exception_ptr& err) const { disposable->observer.on_error(err); }
+    };
+
+    template<rpp::constraint::observer Observer, typename Worker, rpp::details::disposables::constraint::disposable_container Container>
+    class rate_limit_disposable final : public rpp::composite_disposable_impl<Container>
+        , public rpp::details::enable_wrapper_from_this<rate_limit_disposable<Observer, Worker, Container>>
+    {
+        using T = rpp::utils::extract_observer_type_t<Observer>;
+
+    public:
+        rate_limit_disposable(Observer&& in_observer, Worker&& in_worker, const token_bucket& bucket, size_t max_queue_size)
+            : observer(std::move(in_observer))
+            , m_worker{std::move(in_worker)}
+            , m_bucket{bucket}
+            , m_max_queue_size{max_queue_size}
+        {
+            if constexpr (!Worker::is_none_disposable)
+            {
+                if (auto d = m_worker.get_disposable(); !d.is_disposed())
+                    rpp::composite_disposable_impl<Container>::add(std::move(d));
+            }
+        }
+
+        template<typename TT>
+        void on_next(TT&& v)
+        {
+            rpp::schedulers::time_point drain_time;
+            bool                        emit_directly{};
+            {
+                std::lock_guard lock{m_mutex};
+                // emission within budget while nothing is queued goes directly, so, queue and scheduler are not touched at all
+                if (!m_is_active && m_bucket.try_acquire(m_worker.now()))
+                {
+                    emit_directly = true;
+                }
+                else
+                {
+                    if (m_queue.size() < m_max_queue_size)
+                        m_queue.emplace_back(std::forward<TT>(v));
+
+                    if (m_queue.empty() || std::exchange(m_is_active, true))
+                        return;
+                    drain_time = m_bucket.available_at();
+                }
+            }
+
+            if (emit_directly)
+            {
+                // upstream is serialized and drain is not active, so, there is no any concurrent emission
+                observer.on_next(std::forward<TT>(v));
+                return;
+            }
+            schedule_drain(drain_time);
+        }
+
+        void on_error(const std::exception_ptr& err)
+        {
+            {
+                std::lock_guard lock{m_mutex};
+                if (m_is_active)
+                {
+                    m_error = err;
+                    return;
+                }
+            }
+            this->dispose();
+            observer.on_error(err);
+        }
+
+        void on_completed()
+        {
+            {
+                std::lock_guard lock{m_mutex};
+                if (m_is_active)
+                {
+                    m_completed = true;
+                    return;
+                }
+            }
+            this->dispose();
+            observer.on_completed();
+        }
+
+        Observer observer;
+
+    private:
+        std::optional<rpp::schedulers::time_point> drain()
+        {
+            std::unique_lock lock{m_mutex};
+            while (true)
+            {
+                if (m_error)
+                {
+                    const auto err = m_error.value();
+                    m_queue.clear();
+                    lock.unlock();
+                    this->dispose();
+                    observer.on_error(err);
+                    return std::nullopt;
+                }
+
+                if (m_queue.empty())
+                {
+                    m_is_active          = false;
+                    const bool completed = m_completed;
+                    lock.unlock();
+                    if (completed)
+                    {
+                        this->dispose();
+                        observer.on_completed();
+                    }
+                    return std::nullopt;
+                }
+
+                if (!m_bucket.try_acquire(m_worker.now()))
+                    return m_bucket.available_at();
+
+                auto v = std::move(m_queue.front());
+                m_queue.pop_front();
+                lock.unlock();
+                observer.on_next(std::move(v));
+                lock.lock();
+            }
+        }
+
+        void schedule_drain(rpp::schedulers::time_point time)
+        {
+            using wrapper = rate_limit_disposable_wrapper<Observer, Worker, Container>;
+            m_worker.schedule(
+                time,
+                [](const wrapper& handler) -> rpp::schedulers::optional_delay_to {
+                    if (const auto next = handler.disposable->drain())
+                        return rpp::schedulers::optional_delay_to{next.value()};
+                    return std::nullopt;
+                },
+                wrapper{this->wrapper_from_this().lock()});
+        }
+
+        RPP_NO_UNIQUE_ADDRESS Worker m_worker;
+        std::mutex                   m_mutex{};
+        token_bucket                 m_bucket;
+        size_t                       m_max_queue_size;
+
+        std::deque<T>                     m_queue{};
+        std::optional<std::exception_ptr> m_error{};
+        bool                              m_completed{};
+        bool                              m_is_active{};
+    };
+
+    template<rpp::constraint::observer Observer, typename Worker, rpp::details::disposables::constraint::disposable_container Container>
+    struct rate_limit_delay_observer_strategy
+    {
+        std::shared_ptr<rate_limit_disposable<Observer, Worker, Container>> disposable{};
+
+        void set_upstream(const rpp::disposable_wrapper& d) const { disposable->add(d); }
+
+        bool is_disposed() const { return disposable->is_disposed(); }
+
+        template<typename T>
+        void on_next(T&& v) const
+        {
+            disposable->on_next(std::forward<T>(v));
+        }
+
+        void on_error(const std::exception_ptr& err) const { disposable->on_error(err); }
+
+        void on_completed() const { disposable->on_completed(); }
+    };
+
+    template<rpp::schedulers::constraint::scheduler Scheduler>
+    struct rate_limit_delay_t
+    {
+        template<rpp::constraint::decayed_type T>
+        struct operator_traits
+        {
+            using result_type = T;
+        };
+
+        template<rpp::details::observables::constraint::disposable_strategy Prev>
+        using updated_disposable_strategy = rpp::details::observables::fixed_disposable_strategy_selector<1>;
+
+        token_bucket                    bucket;
+        size_t                          max_queue_size;
+        RPP_NO_UNIQUE_ADDRESS Scheduler scheduler;
+
+        template<rpp::constraint::decayed_type Type, rpp::details::observables::constraint::disposable_strategy DisposableStrategy, rpp::constraint::observer Observer>
+        auto lift_with_disposable_strategy(Observer&& observer) const
+        {
+            using worker_t     = rpp::schedulers::utils::get_worker_t<Scheduler>;
+            using container    = typename DisposableStrategy::template add<worker_t::is_none_disposable ? 0 : 1>::disposable_container;
+            using disposable_t = rate_limit_disposable<std::decay_t<Observer>, worker_t, container>;
+
+            const auto disposable = disposable_wrapper_impl<disposable_t>::make(std::forward<Observer>(observer), scheduler.create_worker(), bucket, max_queue_size);
+            auto       ptr        = disposable.lock();
+            ptr->observer.set_upstream(disposable.as_weak());
+            return rpp::observer<Type, rate_limit_delay_observer_strategy<std::decay_t<Observer>, worker_t, container>>{std::move(ptr)};
+        }
+    };
+} // namespace rpp::operators::details
+
+namespace rpp::operators
+{
+    /**
+     * @brief Limits rate of emissions via token bucket: not more than `burst` emissions at once and not more than one emission per `rate` on average. Emissions exceeding rate are dropped.
+     *
+     * @marble rate_limit_drop
+     {
+         source observable                 : +1234-----5-6-|
+         operator "rate_limit(4, burst=2)" : +12-------5-6-|
+     }
+     *
+     * @details Actually this operator keeps single time point (GCRA form of token bucket): tokens are refilled lazily by comparing it with current time of scheduler, so, there is no any timer at all.
+     * @details In contrast to `throttle`, `burst` emissions can pass at once after idle period.
+     *
+     * @par Performance notes:
+     * - No any heap allocations at all
+     * - Obtaining "now" every emission, emissions within budget are forwarded as is
+     *
+     * @param rate is minimal average interval between emissions (one token is refilled each `rate`)
+     * @param burst is maximal amount of tokens (emissions which can pass at once)
+     * @param scheduler is scheduler used to obtain current time
+     *
+     * @warning #include <rpp/operators/rate_limit.hpp>
+     *
+     * @ingroup filtering_operators
+     */
+    template<rpp::schedulers::constraint::scheduler Scheduler>
+    auto rate_limit(rpp::schedulers::duration rate, size_t burst, const Scheduler& /*scheduler*/, rate_limit_policy::drop /*policy*/)
+    {
+        return details::rate_limit_drop_t<Scheduler>{details::token_bucket{rate, burst}};
+    }
+
+    /**
+     * @brief Limits rate of emissions via token bucket: not more than `burst` emissions at once and not more than one emission per `rate` on average. Emissions exceeding rate are delayed till rate allows them.
+     *
+     * @marble rate_limit_delay
+     {
+         source observable                 : +123-------|
+         operator "rate_limit(4, burst=2)" : +12--3-----|
+     }
+     *
+     * @details Actually this operator keeps single time point (GCRA form of token bucket) refilled lazily by comparing it with current time of scheduler. While queue is empty, emission within budget is forwarded immediately from the caller's thread without touching scheduler. Otherwise emission is queued and drained via scheduler as soon as the next token is available.
+     * @details Emissions arrived when queue contains `max_queue_size` emissions are dropped. on_completed and on_error are forwarded after queued emissions.
+     *
+     * @par Performance notes:
+     * - 1 heap allocation for state
+     * - Mutex acquired and "now" obtained every emission, emissions within budget are not copied/moved to queue
+     *
+     * @param rate is minimal average interval between emissions (one token is refilled each `rate`)
+     * @param burst is maximal amount of tokens (emissions which can pass at once)
+     * @param scheduler is scheduler used to obtain current time and to emit delayed emissions
+     * @param policy keeps maximal size of queue for delayed emissions
+     *
+     * @warning #include <rpp/operators/rate_limit.hpp>
+     *
+     * @ingroup filtering_operators
+     */
+    template<rpp::schedulers::constraint::scheduler Scheduler>
+    auto rate_limit(rpp::schedulers::duration rate, size_t burst, Scheduler&& scheduler, rate_limit_policy::delay policy)
+    {
+        return details::rate_limit_delay_t<std::decay_t<Scheduler>>{details::token_bucket{rate, burst}, policy.max_queue_size, std::forward<Scheduler>(scheduler)};
+    }
+} // namespace rpp::operators
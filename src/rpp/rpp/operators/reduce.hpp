@@ -13,6 +13,7 @@
 #include <rpp/operators/fwd.hpp>
 
 #include <rpp/defs.hpp>
+#include <rpp/disposables/demand_disposable.hpp>
 #include <rpp/operators/details/strategy.hpp>
 
 namespace rpp::operators::details
@@ -41,7 +42,7 @@ namespace rpp::operators::details
             observer.on_completed();
         }
 
-        void set_upstream(const disposable_wrapper& d) { observer.set_upstream(d); }
+        void set_upstream(const disposable_wrapper& d) { observer.set_upstream(rpp::details::hide_demand(d)); }
 
         bool is_disposed() const { return observer.is_disposed(); }
     };
@@ -93,7 +94,7 @@ namespace rpp::operators::details
             observer.on_completed();
         }
 
-        void set_upstream(const disposable_wrapper& d) { observer.set_upstream(d); }
+        void set_upstream(const disposable_wrapper& d) { observer.set_upstream(rpp::details::hide_demand(d)); }
 
         bool is_disposed() const { return observer.is_disposed(); }
     };
@@ -0,0 +1,342 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/operators/fwd.hpp>
+
+#include <rpp/defs.hpp>
+#include <rpp/disposables/composite_disposable.hpp>
+#include <rpp/operators/details/strategy.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+namespace rpp::operators
+{
+    /**
+     * @brief Counters of rpp::operators::reorder_by. Can be read at any time from any thread.
+     */
+    struct reorder_stats
+    {
+        /**
+         * @brief Amount of events arrived after event with greater timestamp, but not later than watermark, so, they were reordered.
+         */
+        std::atomic<size_t> late{};
+        /**
+         * @brief Amount of events arrived after watermark passed their timestamp, so, they were dropped.
+         */
+        std::atomic<size_t> dropped{};
+    };
+} // namespace rpp::operators
+
+namespace rpp::operators::details
+{
+    template<rpp::constraint::observer Observer, typename Worker, rpp::details::disposables::constraint::disposable_container Container, rpp::constraint::decayed_type TimestampSelector>
+    class reorder_by_disposable;
+
+    template<rpp::constraint::observer Observer, typename Worker, rpp::details::disposables::constraint::disposable_container Container, rpp::constraint::decayed_type TimestampSelector>
+    struct reorder_by_disposable_wrapper
+    {
+        std::shared_ptr<reorder_by_disposable<Observer, Worker, Container, TimestampSelector>> disposable{};
+
+        bool is_disposed() const { return disposable->is_disposed(); }
+
+        void on_error(const std::exception_ptr& err) const { disposable->on_error(err); }
+    };
+
+    template<rpp::constraint::observer Observer, typename Worker, rpp::details::disposables::constraint::disposable_container Container, rpp::constraint::decayed_type TimestampSelector>
+    class reorder_by_disposable final : public rpp::composite_disposable_impl<Container>
+        , public rpp::details::enable_wrapper_from_this<reorder_by_disposable<Observer, Worker, Container, TimestampSelector>>
+    {
+        using T          = rpp::utils::extract_observer_type_t<Observer>;
+        using TTimestamp = rpp::utils::decayed_invoke_result_t<TimestampSelector, T>;
+
+        struct entry
+        {
+            TTimestamp timestamp;
+            size_t     seq;
+            T          value;
+
+            // std::*_heap keeps max on top, so, invert to keep the earliest one (and the first arrived among equal ones)
+            bool operator<(const entry& other) const { return std::tie(other.timestamp, other.seq) < std::tie(timestamp, seq); }
+        };
+
+    public:
+        reorder_by_disposable(Observer&& in_observer, Worker&& in_worker, const TimestampSelector& timestamp_selector, rpp::schedulers::duration max_lateness, std::shared_ptr<reorder_stats> stats)
+            : m_observer(std::move(in_observer))
+            , m_worker{std::move(in_worker)}
+            , m_timestamp_selector{timestamp_selector}
+            , m_max_lateness{max_lateness}
+            , m_stats{std::move(stats)}
+        {
+            if constexpr (!Worker::is_none_disposable)
+            {
+                if (auto d = m_worker.get_disposable(); !d.is_disposed())
+                    rpp::composite_disposable_impl<Container>::add(std::move(d));
+            }
+        }
+
+        void set_upstream_for_observer(const rpp::disposable_wrapper& d)
+        {
+            std::lock_guard lock{m_mutex};
+            m_observer.set_upstream(d);
+        }
+
+        template<typename TT>
+        void on_next(TT&& v)
+        {
+            schedulers::time_point now;
+            {
+                std::lock_guard lock{m_mutex};
+                if (!emplace(m_timestamp_selector(rpp::utils::as_const(v)), std::forward<TT>(v)))
+                    return;
+
+                now            = m_worker.now();
+                m_last_arrival = now;
+                if (m_heap.empty() || std::exchange(m_timer_scheduled, true))
+                    return;
+            }
+            // scheduled outside of lock due to worker can execute it immediately
+            schedule_timer(now + m_max_lateness);
+        }
+
+        void on_error(const std::exception_ptr& err)
+        {
+            rpp::composite_disposable_impl<Container>::dispose();
+            std::lock_guard lock{m_mutex};
+            m_heap.clear();
+            m_observer.on_error(err);
+        }
+
+        void on_completed()
+        {
+            rpp::composite_disposable_impl<Container>::dispose();
+            std::lock_guard lock{m_mutex};
+            release_all();
+            m_observer.on_completed();
+        }
+
+    private:
+        /**
+         * @return false if value was dropped
+         */
+        template<typename TT>
+        bool emplace(TTimestamp timestamp, TT&& v)
+        {
+            if (m_watermark && timestamp < m_watermark.value())
+            {
+                increment(&reorder_stats::dropped);
+                return false;
+            }
+
+            if (!m_max_seen || m_max_seen.value() < timestamp)
+                m_max_seen = timestamp;
+            else if (timestamp < m_max_seen.value())
+                increment(&reorder_stats::late);
+
+            m_heap.push_back(entry{std::move(timestamp), m_seq++, std::forward<TT>(v)});
+            std::push_heap(m_heap.begin(), m_heap.end());
+
+            const TTimestamp watermark = m_max_seen.value() - m_max_lateness;
+            if (!m_watermark || m_watermark.value() < watermark)
+                m_watermark = watermark;
+
+            release_till_watermark();
+            return true;
+        }
+
+        void release_till_watermark()
+        {
+            while (!m_heap.empty() && !(m_watermark.value() < m_heap.front().timestamp))
+                release_top();
+        }
+
+        void release_all()
+        {
+            if (m_max_seen)
+                m_watermark = m_max_seen;
+            while (!m_heap.empty())
+                release_top();
+        }
+
+        void release_top()
+        {
+            std::pop_heap(m_heap.begin(), m_heap.end());
+            auto value = std::move(m_heap.back().value);
+            m_heap.pop_back();
+            m_observer.on_next(std::move(value));
+        }
+
+        /**
+         * @brief Releases all buffered events if there were no new events for `max_lateness`
+         * @return time when timer should be checked again if needed
+         */
+        std::optional<schedulers::time_point> on_timer()
+        {
+            std::lock_guard lock{m_mutex};
+            if (!m_heap.empty() && m_worker.now() - m_last_arrival < m_max_lateness)
+                return m_last_arrival + m_max_lateness;
+
+            release_all();
+            m_timer_scheduled = false;
+            return std::nullopt;
+        }
+
+        void schedule_timer(schedulers::time_point time)
+        {
+            using wrapper = reorder_by_disposable_wrapper<Observer, Worker, Container, TimestampSelector>;
+            m_worker.schedule(
+                time,
+                [](const wrapper& handler) -> schedulers::optional_delay_to {
+                    if (const auto next = handler.disposable->on_timer())
+                        return schedulers::optional_delay_to{next.value()};
+                    return std::nullopt;
+                },
+                wrapper{this->wrapper_from_this().lock()});
+        }
+
+        void increment(std::atomic<size_t> reorder_stats::*counter) const
+        {
+            if (m_stats)
+                ((*m_stats).*counter).fetch_add(1, std::memory_order::relaxed);
+        }
+
+    private:
+        std::mutex                              m_mutex{};
+        Observer                                m_observer;
+        RPP_NO_UNIQUE_ADDRESS Worker            m_worker;
+        RPP_NO_UNIQUE_ADDRESS TimestampSelector m_timestamp_selector;
+        rpp::schedulers::duration               m_max_lateness;
+        std::shared_ptr<reorder_stats>          m_stats;
+
+        std::vector<entry>        m_heap{};
+        std::optional<TTimestamp> m_max_seen{};
+        std::optional<TTimestamp> m_watermark{};
+        size_t                    m_seq{};
+        schedulers::time_point    m_last_arrival{};
+        bool                      m_timer_scheduled{};
+    };
+
+    template<rpp::constraint::observer Observer, typename Worker, rpp::details::disposables::constraint::disposable_container Container, rpp::constraint::decayed_type TimestampSelector>
+    struct reorder_by_observer_strategy
+    {
+        using preferred_disposable_strategy = rpp::details::observers::none_disposable_strategy;
+
+        std::shared_ptr<reorder_by_disposable<Observer, Worker, Container, TimestampSelector>> disposable{};
+
+        void set_upstream(const rpp::disposable_wrapper& d) const { disposable->add(d); }
+
+        bool is_disposed() const { return disposable->is_disposed(); }
+
+        template<typename T>
+        void on_next(T&& v) const
+        {
+            disposable->on_next(std::forward<T>(v));
+        }
+
+        void on_error(const std::exception_ptr& err) const { disposable->on_error(err); }
+
+        void on_completed() const { disposable->on_completed(); }
+    };
+
+    template<rpp::constraint::decayed_type TimestampSelector, rpp::schedulers::constraint::scheduler Scheduler>
+    struct reorder_by_t
+    {
+        template<rpp::constraint::decayed_type T>
+        struct operator_traits
+        {
+            static_assert(std::invocable<TimestampSelector, T>, "TimestampSelector is not invocable with T");
+            static_assert(requires(const rpp::utils::decayed_invoke_result_t<TimestampSelector, T>& ts, rpp::schedulers::duration d) { { ts - d } -> std::convertible_to<rpp::utils::decayed_invoke_result_t<TimestampSelector, T>>; ts < ts; }, "Result of TimestampSelector should be ordered time point compatible with rpp::schedulers::duration (like any std::chrono::time_point)");
+
+            using result_type = T;
+        };
+
+        template<rpp::details::observables::constraint::disposable_strategy Prev>
+        using updated_disposable_strategy = rpp::details::observables::fixed_disposable_strategy_selector<1>;
+
+        RPP_NO_UNIQUE_ADDRESS TimestampSelector timestamp_selector;
+        rpp::schedulers::duration               max_lateness;
+        RPP_NO_UNIQUE_ADDRESS Scheduler         scheduler;
+        std::shared_ptr<reorder_stats>          stats;
+
+        template<rpp::constraint::decayed_type Type, rpp::details::observables::constraint::disposable_strategy DisposableStrategy, rpp::constraint::observer Observer>
+        auto lift_with_disposable_strategy(Observer&& observer) const
+        {
+            using worker_t     = rpp::schedulers::utils::get_worker_t<Scheduler>;
+            using container    = typename DisposableStrategy::template add<worker_t::is_none_disposable ? 0 : 1>::disposable_container;
+            using disposable_t = reorder_by_disposable<std::decay_t<Observer>, worker_t, container, TimestampSelector>;
+
+            const auto disposable = disposable_wrapper_impl<disposable_t>::make(std::forward<Observer>(observer), scheduler.create_worker(), timestamp_selector, max_lateness, stats);
+            auto       ptr        = disposable.lock();
+            ptr->set_upstream_for_observer(disposable.as_weak());
+            return rpp::observer<Type, reorder_by_observer_strategy<std::decay_t<Observer>, worker_t, container, TimestampSelector>>{std::move(ptr)};
+        }
+    };
+} // namespace rpp::operators::details
+
+namespace rpp::operators
+{
+    /**
+     * @brief Emits emissions ordered by their event time (obtained via timestamp_selector) in case of upstream delivers them slightly out-of-order.
+     *
+     * @marble reorder_by
+     {
+         source observable                       : +-1-3-2-5-4-8-|
+         operator "reorder_by: x=>x, lateness=2" : +---1---23--45-8|
+     }
+     *
+     * @details Actually this operator keeps emissions inside min-heap by timestamp and tracks watermark `max seen timestamp - max_lateness`. Each emission with timestamp not greater than watermark is released in order. Emission arrived with timestamp less than watermark can't be emitted in order anymore, so, it is dropped.
+     * @details In case of no any new emissions during `max_lateness` (by time of provided scheduler) all buffered emissions are released, so, emissions are not stuck when upstream is idle.
+     * @details on_completed releases all buffered emissions, on_error drops them.
+     *
+     * @par Performance notes:
+     * - 1 heap allocation for state
+     * - O(log n) per emission where n is amount of buffered emissions, no heap allocations after warm-up
+     * - Mutex acquired for each emission
+     *
+     * @param timestamp_selector is function which returns event time for provided value. Result should be any `std::chrono::time_point` (or any other ordered type supporting subtraction of rpp::schedulers::duration).
+     * @param max_lateness is maximal delay (in terms of event time) of emission relative to emission with the greatest timestamp seen so far, to keep it in order
+     * @param scheduler is scheduler used to release buffered emissions when upstream is idle
+     *
+     * @warning #include <rpp/operators/reorder_by.hpp>
+     *
+     * @ingroup utility_operators
+     */
+    template<typename TimestampSelector, rpp::schedulers::constraint::scheduler Scheduler>
+        requires (!utils::is_not_template_callable<TimestampSelector> || !std::same_as<void, std::invoke_result_t<TimestampSelector, rpp::utils::convertible_to_any>>)
+    auto reorder_by(TimestampSelector&& timestamp_selector, rpp::schedulers::duration max_lateness, Scheduler&& scheduler)
+    {
+        return details::reorder_by_t<std::decay_t<TimestampSelector>, std::decay_t<Scheduler>>{std::forward<TimestampSelector>(timestamp_selector), max_lateness, std::forward<Scheduler>(scheduler), nullptr};
+    }
+
+    /**
+     * @brief Same as rpp::operators::reorder_by, but updates provided counters of late and dropped emissions.
+     *
+     * @param timestamp_selector is function which returns event time for provided value. Result should be any `std::chrono::time_point` (or any other ordered type supporting subtraction of rpp::schedulers::duration).
+     * @param max_lateness is maximal delay (in terms of event time) of emission relative to emission with the greatest timestamp seen so far, to keep it in order
+     * @param scheduler is scheduler used to release buffered emissions when upstream is idle
+     * @param stats is counters updated by all subscriptions of this operator
+     *
+     * @warning #include <rpp/operators/reorder_by.hpp>
+     *
+     * @ingroup utility_operators
+     */
+    template<typename TimestampSelector, rpp::schedulers::constraint::scheduler Scheduler>
+        requires (!utils::is_not_template_callable<TimestampSelector> || !std::same_as<void, std::invoke_result_t<TimestampSelector, rpp::utils::convertible_to_any>>)
+    auto reorder_by(TimestampSelector&& timestamp_selector, rpp::schedulers::duration max_lateness, Scheduler&& scheduler, std::shared_ptr<reorder_stats> stats)
+    {
+        return details::reorder_by_t<std::decay_t<TimestampSelector>, std::decay_t<Scheduler>>{std::forward<TimestampSelector>(timestamp_selector), max_lateness, std::forward<Scheduler>(scheduler), std::move(stats)};
+    }
+} // namespace rpp::operators
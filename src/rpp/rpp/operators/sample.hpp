@@ -0,0 +1,216 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/operators/fwd.hpp>
+
+#include <rpp/disposables/composite_disposable.hpp>
+#include <rpp/operators/details/strategy.hpp>
+#include <rpp/operators/details/utils.hpp>
+
+namespace rpp::operators::details
+{
+    template<rpp::constraint::observer Observer, typename Worker, rpp::details::disposables::constraint::disposable_container Container>
+    class sample_disposable;
+
+    template<rpp::constraint::observer Observer, typename Worker, rpp::details::disposables::constraint::disposable_container Container>
+    struct sample_disposable_wrapper
+    {
+        std::shared_ptr<sample_disposable<Observer, Worker, Container>> disposable{};
+
+        bool is_disposed() const { return disposable->is_disposed(); }
+
+        void on_error(const std::exception_ptr& err) const { disposable->get_observer_under_lock()->on_error(err); }
+    };
+
+    template<rpp::constraint::observer Observer, typename Worker, rpp::details::disposables::constraint::disposable_container Container>
+    class sample_disposable final : public rpp::composite_disposable_impl<Container>
+        , public rpp::details::enable_wrapper_from_this<sample_disposable<Observer, Worker, Container>>
+    {
+        using T = rpp::utils::extract_observer_type_t<Observer>;
+
+    public:
+        sample_disposable(Observer&& in_observer, Worker&& in_worker, rpp::schedulers::duration period)
+            : m_observer(std::move(in_observer))
+            , m_worker{std::move(in_worker)}
+            , m_period{period}
+            , m_start{m_worker.now()}
+        {
+            if constexpr (!Worker::is_none_disposable)
+            {
+                if (auto d = m_worker.get_disposable(); !d.is_disposed())
+                    rpp::composite_disposable_impl<Container>::add(std::move(d));
+            }
+        }
+
+        template<typename TT>
+        void emplace_safe(TT&& v)
+        {
+            {
+                std::lock_guard lock{m_mutex};
+                m_value_to_be_emitted.emplace(std::forward<TT>(v));
+                if (std::exchange(m_is_timer_scheduled, true))
+                    return;
+            }
+            // worker can execute schedulable immediately, so, schedule it outside of lock
+            schedule(next_tick(m_worker.now()));
+        }
+
+        std::optional<T> extract_value()
+        {
+            std::lock_guard lock{m_mutex};
+            return std::exchange(m_value_to_be_emitted, std::optional<T>{});
+        }
+
+        pointer_under_lock<Observer> get_observer_under_lock() { return pointer_under_lock{m_observer}; }
+
+    private:
+        rpp::schedulers::time_point next_tick(rpp::schedulers::time_point now) const
+        {
+            // ticks are aligned to time of subscription, so, rare emissions don't shift sampling grid
+            return m_start + ((now - m_start) / m_period + 1) * m_period;
+        }
+
+        void schedule(rpp::schedulers::time_point time)
+        {
+            m_worker.schedule(
+                time,
+                [](const sample_disposable_wrapper<Observer, Worker, Container>& handler) -> schedulers::optional_delay_to {
+                    auto value = handler.disposable->extract_value_or_stop_timer();
+                    if (!value)
+                        return std::nullopt;
+
+                    handler.disposable->get_observer_under_lock()->on_next(std::move(value).value());
+                    return schedulers::optional_delay_to{handler.disposable->next_tick(handler.disposable->m_worker.now())};
+                },
+                sample_disposable_wrapper<Observer, Worker, Container>{this->wrapper_from_this().lock()});
+        }
+
+        std::optional<T> extract_value_or_stop_timer()
+        {
+            std::lock_guard lock{m_mutex};
+            // timer is kept only while there are emissions to sample
+            if (!m_value_to_be_emitted)
+                m_is_timer_scheduled = false;
+            return std::exchange(m_value_to_be_emitted, std::optional<T>{});
+        }
+
+        value_with_mutex<Observer>   m_observer;
+        RPP_NO_UNIQUE_ADDRESS Worker m_worker;
+        rpp::schedulers::duration    m_period;
+        rpp::schedulers::time_point  m_start;
+
+        std::mutex       m_mutex{};
+        std::optional<T> m_value_to_be_emitted{};
+        bool             m_is_timer_scheduled{};
+    };
+
+    template<rpp::constraint::observer Observer, typename Worker, rpp::details::disposables::constraint::disposable_container Container>
+    struct sample_observer_strategy
+    {
+        using preferred_disposable_strategy = rpp::details::observers::none_disposable_strategy;
+
+        std::shared_ptr<sample_disposable<Observer, Worker, Container>> disposable{};
+
+        void set_upstream(const rpp::disposable_wrapper& d) const
+        {
+            disposable->add(d);
+        }
+
+        bool is_disposed() const
+        {
+            return disposable->is_disposed();
+        }
+
+        template<typename T>
+        void on_next(T&& v) const
+        {
+            disposable->emplace_safe(std::forward<T>(v));
+        }
+
+        void on_error(const std::exception_ptr& err) const noexcept
+        {
+            disposable->dispose();
+            disposable->get_observer_under_lock()->on_error(err);
+        }
+
+        void on_completed() const noexcept
+        {
+            disposable->dispose();
+            const auto value    = disposable->extract_value();
+            const auto observer = disposable->get_observer_under_lock();
+            if (value)
+                observer->on_next(std::move(value).value());
+            observer->on_completed();
+        }
+    };
+
+    template<rpp::schedulers::constraint::scheduler Scheduler>
+    struct sample_t
+    {
+        template<rpp::constraint::decayed_type T>
+        struct operator_traits
+        {
+            using result_type = T;
+        };
+
+        template<rpp::details::observables::constraint::disposable_strategy Prev>
+        using updated_disposable_strategy = rpp::details::observables::fixed_disposable_strategy_selector<1>;
+
+        rpp::schedulers::duration       period;
+        RPP_NO_UNIQUE_ADDRESS Scheduler scheduler;
+
+        template<rpp::constraint::decayed_type Type, rpp::details::observables::constraint::disposable_strategy DisposableStrategy, rpp::constraint::observer Observer>
+        auto lift_with_disposable_strategy(Observer&& observer) const
+        {
+            using worker_t  = rpp::schedulers::utils::get_worker_t<Scheduler>;
+            using container = typename DisposableStrategy::template add<worker_t::is_none_disposable ? 0 : 1>::disposable_container;
+
+            const auto disposable = disposable_wrapper_impl<sample_disposable<std::decay_t<Observer>, worker_t, container>>::make(std::forward<Observer>(observer), scheduler.create_worker(), period);
+            auto       ptr        = disposable.lock();
+            ptr->get_observer_under_lock()->set_upstream(disposable.as_weak());
+            return rpp::observer<Type, sample_observer_strategy<std::decay_t<Observer>, worker_t, container>>{std::move(ptr)};
+        }
+    };
+} // namespace rpp::operators::details
+
+namespace rpp::operators
+{
+    /**
+     * @brief Emit the most recent emission from an Observable each `period` of time if there was any new emission since previous tick.
+     *
+     * @marble sample
+     {
+         source    observable : +1-2-3-----4---|
+         operator "sample(4)" : +---2---3---4--|
+     }
+     *
+     * @details Actually this operator keeps only latest emission and schedules tick on the same timer infrastructure as `debounce`. Ticks are aligned to time of subscription, but timer is scheduled only while there are new emissions, so, idle source doesn't produce any scheduler activity.
+     * @details Latest not emitted emission is emitted on completion of original observable.
+     *
+     * @par Performance notes:
+     * - 1 heap allocation for state
+     * - Mutex acquired every emission, emission is copied/moved into internal storage replacing previous one
+     *
+     * @param period is duration of time between ticks
+     * @param scheduler is scheduler used to run timer for sampling
+     *
+     * @warning #include <rpp/operators/sample.hpp>
+     *
+     * @ingroup filtering_operators
+     * @see https://reactivex.io/documentation/operators/sample.html
+     */
+    template<rpp::schedulers::constraint::scheduler Scheduler>
+    auto sample(rpp::schedulers::duration period, Scheduler&& scheduler)
+    {
+        return details::sample_t<std::decay_t<Scheduler>>{period, std::forward<Scheduler>(scheduler)};
+    }
+} // namespace rpp::operators
@@ -0,0 +1,277 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/operators/fwd.hpp>
+
+#include <rpp/defs.hpp>
+#include <rpp/disposables/demand_disposable.hpp>
+#include <rpp/operators/details/strategy.hpp>
+#include <rpp/utils/open_addressing_map.hpp>
+#include <rpp/utils/utils.hpp>
+
+#include <optional>
+#include <utility>
+
+namespace rpp::operators::details
+{
+    struct no_idle_eviction
+    {
+        static constexpr bool enabled = false;
+    };
+
+    template<typename Worker>
+    struct idle_eviction
+    {
+        static constexpr bool enabled = true;
+
+        rpp::schedulers::duration                     timeout;
+        mutable std::optional<schedulers::time_point> last_sweep{};
+
+        static rpp::schedulers::time_point now() { return Worker::now(); }
+    };
+
+    template<rpp::constraint::decayed_type Seed, typename Eviction>
+    struct keyed_accumulator
+    {
+        Seed                                                                                           state;
+        RPP_NO_UNIQUE_ADDRESS std::conditional_t<Eviction::enabled, schedulers::time_point, utils::none> last_update{};
+    };
+
+    /**
+     * @brief Keeps accumulator per key inside flat map. Emits `(key, state)` on each update in case of `EmitOnEachUpdate` (scan_by_key) or all of them on completion otherwise (reduce_by_key).
+     */
+    template<rpp::constraint::observer TObserver, rpp::constraint::decayed_type KeySelector, rpp::constraint::decayed_type Seed, rpp::constraint::decayed_type Accumulator, typename Eviction, bool EmitOnEachUpdate>
+    struct accumulate_by_key_observer_strategy
+    {
+        using preferred_disposable_strategy = rpp::details::observers::none_disposable_strategy;
+
+        using TKey = typename rpp::utils::extract_observer_type_t<TObserver>::first_type;
+
+        RPP_NO_UNIQUE_ADDRESS TObserver   observer;
+        RPP_NO_UNIQUE_ADDRESS KeySelector key_selector;
+        RPP_NO_UNIQUE_ADDRESS Seed        seed;
+        RPP_NO_UNIQUE_ADDRESS Accumulator accumulator;
+        RPP_NO_UNIQUE_ADDRESS Eviction    eviction;
+
+        mutable rpp::utils::open_addressing_map<TKey, keyed_accumulator<Seed, Eviction>> accumulators{};
+
+        template<typename T>
+        void on_next(T&& v) const
+        {
+            auto key = key_selector(utils::as_const(v));
+
+            if constexpr (Eviction::enabled)
+                evict_idle(eviction.now());
+
+            auto* acc  = accumulators.try_emplace(key, keyed_accumulator<Seed, Eviction>{seed}).first;
+            acc->state = accumulator(std::move(acc->state), std::forward<T>(v));
+
+            if constexpr (Eviction::enabled)
+                acc->last_update = eviction.now();
+
+            if constexpr (EmitOnEachUpdate)
+                observer.on_next(std::pair<TKey, Seed>{std::move(key), acc->state});
+        }
+
+        void on_error(const std::exception_ptr& err) const { observer.on_error(err); }
+
+        void on_completed() const
+        {
+            if constexpr (!EmitOnEachUpdate)
+            {
+                accumulators.for_each([this](const TKey& key, keyed_accumulator<Seed, Eviction>& acc) {
+                    observer.on_next(std::pair<TKey, Seed>{key, std::move(acc.state)});
+                });
+                accumulators.clear();
+            }
+            observer.on_completed();
+        }
+
+        void set_upstream(const disposable_wrapper& d)
+        {
+            if constexpr (EmitOnEachUpdate)
+                observer.set_upstream(d);
+            else
+                observer.set_upstream(rpp::details::hide_demand(d));
+        }
+
+        bool is_disposed() const { return observer.is_disposed(); }
+
+    private:
+        void evict_idle(schedulers::time_point now) const
+        {
+            // full sweep once per timeout keeps eviction amortized O(1) per emission
+            if (eviction.last_sweep && now - eviction.last_sweep.value() < eviction.timeout)
+                return;
+
+            eviction.last_sweep = now;
+            accumulators.erase_if([&](const TKey& key, keyed_accumulator<Seed, Eviction>& acc) {
+                if (now - acc.last_update < eviction.timeout)
+                    return false;
+
+                // reduce_by_key emits final state of idle key, scan_by_key already emitted it
+                if constexpr (!EmitOnEachUpdate)
+                    observer.on_next(std::pair<TKey, Seed>{key, std::move(acc.state)});
+                return true;
+            });
+        }
+    };
+
+    template<rpp::constraint::decayed_type KeySelector, rpp::constraint::decayed_type Seed, rpp::constraint::decayed_type Accumulator, typename Eviction, bool EmitOnEachUpdate>
+    struct accumulate_by_key_t : lift_operator<accumulate_by_key_t<KeySelector, Seed, Accumulator, Eviction, EmitOnEachUpdate>, KeySelector, Seed, Accumulator, Eviction>
+    {
+        using operators::details::lift_operator<accumulate_by_key_t<KeySelector, Seed, Accumulator, Eviction, EmitOnEachUpdate>, KeySelector, Seed, Accumulator, Eviction>::lift_operator;
+
+        template<rpp::constraint::decayed_type T>
+        struct operator_traits
+        {
+            static_assert(std::invocable<KeySelector, T>, "KeySelector is not invocacble with T");
+            static_assert(rpp::constraint::hashable<rpp::utils::decayed_invoke_result_t<KeySelector, T>>, "Result of KeySelector is not hashable");
+            static_assert(std::is_invocable_r_v<Seed, Accumulator, Seed&&, T>, "Accumulator is not invocable with Seed&& abnd T returning Seed");
+
+            using result_type = std::pair<rpp::utils::decayed_invoke_result_t<KeySelector, T>, Seed>;
+
+            template<rpp::constraint::observer_of_type<result_type> TObserver>
+            using observer_strategy = accumulate_by_key_observer_strategy<TObserver, KeySelector, Seed, Accumulator, Eviction, EmitOnEachUpdate>;
+        };
+
+        template<rpp::details::observables::constraint::disposable_strategy Prev>
+        using updated_disposable_strategy = Prev;
+    };
+} // namespace rpp::operators::details
+
+namespace rpp::operators
+{
+    /**
+     * @brief Apply accumulator function for each emission and accumulator of its key (obtained via key_selector) and emit pair of key and resulting accumulator.
+     *
+     * @marble scan_by_key
+     {
+         source observable                               : +--1-2-3-4-|
+         operator "scan_by_key: x=>x%2, s=0, (s,x)=>s+x" : +--1-2-4-6-|
+     }
+     *
+     * @details Marble shows only accumulators, actually each emission is `std::pair{key, accumulator}`.
+     * @details Same as `group_by` + `scan` for each group, but all accumulators are kept inside one flat open-addressing hash map inside observer without any subject or subscription per key.
+     *
+     * @par Performance notes:
+     * - No any heap allocations except of growing of hash map
+     * - Accumulator is stored inline in hash map, so, per-key overhead is size of key + accumulator
+     * - Key and accumulator are copied to emitted pair
+     *
+     * @param key_selector is function which returns key for provided value. Result of this function should be hashable.
+     * @param initial_value initial value for accumulator of each new key.
+     * @param accumulator function which accepts accumulator of key and new value from observable and return new value of accumulator. Can accept accumulator by move-reference.
+     *
+     * @warning #include <rpp/operators/scan_by_key.hpp>
+     *
+     * @ingroup transforming_operators
+     * @see https://reactivex.io/documentation/operators/scan.html
+     */
+    template<typename KeySelector, typename InitialValue, typename Fn>
+        requires (!utils::is_not_template_callable<Fn> || std::same_as<std::decay_t<InitialValue>, std::invoke_result_t<Fn, std::decay_t<InitialValue> &&, rpp::utils::convertible_to_any>>)
+    auto scan_by_key(KeySelector&& key_selector, InitialValue&& initial_value, Fn&& accumulator)
+    {
+        return details::accumulate_by_key_t<std::decay_t<KeySelector>, std::decay_t<InitialValue>, std::decay_t<Fn>, details::no_idle_eviction, true>{std::forward<KeySelector>(key_selector),
+                                                                                                                                                     std::forward<InitialValue>(initial_value),
+                                                                                                                                                     std::forward<Fn>(accumulator),
+                                                                                                                                                     details::no_idle_eviction{}};
+    }
+
+    /**
+     * @brief Same as rpp::operators::scan_by_key, but forgets accumulator of key which was not updated for `idle_timeout` (next value of such a key starts from initial value again).
+     * @details Idle keys are evicted lazily during emissions: whole map is swept not more often than once per `idle_timeout`, so, key can live up to two `idle_timeout` after last update.
+     *
+     * @param key_selector is function which returns key for provided value. Result of this function should be hashable.
+     * @param initial_value initial value for accumulator of each new key.
+     * @param accumulator function which accepts accumulator of key and new value from observable and return new value of accumulator. Can accept accumulator by move-reference.
+     * @param idle_timeout is duration after last update when accumulator of key can be evicted
+     * @param scheduler is scheduler used to obtain current time
+     *
+     * @warning #include <rpp/operators/scan_by_key.hpp>
+     *
+     * @ingroup transforming_operators
+     * @see https://reactivex.io/documentation/operators/scan.html
+     */
+    template<typename KeySelector, typename InitialValue, typename Fn, rpp::schedulers::constraint::scheduler Scheduler>
+        requires (!utils::is_not_template_callable<Fn> || std::same_as<std::decay_t<InitialValue>, std::invoke_result_t<Fn, std::decay_t<InitialValue> &&, rpp::utils::convertible_to_any>>)
+    auto scan_by_key(KeySelector&& key_selector, InitialValue&& initial_value, Fn&& accumulator, rpp::schedulers::duration idle_timeout, const Scheduler& /*scheduler*/)
+    {
+        using eviction = details::idle_eviction<rpp::schedulers::utils::get_worker_t<Scheduler>>;
+        return details::accumulate_by_key_t<std::decay_t<KeySelector>, std::decay_t<InitialValue>, std::decay_t<Fn>, eviction, true>{std::forward<KeySelector>(key_selector),
+                                                                                                                                     std::forward<InitialValue>(initial_value),
+                                                                                                                                     std::forward<Fn>(accumulator),
+                                                                                                                                     eviction{idle_timeout}};
+    }
+
+    /**
+     * @brief Apply accumulator function for each emission and accumulator of its key (obtained via key_selector) and emit pairs of key and final accumulator for each key when observable completes.
+     *
+     * @marble reduce_by_key
+     {
+         source observable                                 : +--1-2-3-4-|
+         operator "reduce_by_key: x=>x%2, s=0, (s,x)=>s+x" : +----------46|
+     }
+     *
+     * @details Marble shows only accumulators, actually each emission is `std::pair{key, accumulator}`.
+     * @details Same as `group_by` + `reduce` for each group, but all accumulators are kept inside one flat open-addressing hash map inside observer without any subject or subscription per key.
+     * @warning Order of emitted pairs is unspecified
+     *
+     * @par Performance notes:
+     * - No any heap allocations except of growing of hash map
+     * - Accumulator is stored inline in hash map, so, per-key overhead is size of key + accumulator
+     *
+     * @param key_selector is function which returns key for provided value. Result of this function should be hashable.
+     * @param initial_value initial value for accumulator of each new key.
+     * @param accumulator function which accepts accumulator of key and new value from observable and return new value of accumulator. Can accept accumulator by move-reference.
+     *
+     * @warning #include <rpp/operators/scan_by_key.hpp>
+     *
+     * @ingroup aggregate_operators
+     * @see https://reactivex.io/documentation/operators/reduce.html
+     */
+    template<typename KeySelector, typename InitialValue, typename Fn>
+        requires (!utils::is_not_template_callable<Fn> || std::same_as<std::decay_t<InitialValue>, std::invoke_result_t<Fn, std::decay_t<InitialValue> &&, rpp::utils::convertible_to_any>>)
+    auto reduce_by_key(KeySelector&& key_selector, InitialValue&& initial_value, Fn&& accumulator)
+    {
+        return details::accumulate_by_key_t<std::decay_t<KeySelector>, std::decay_t<InitialValue>, std::decay_t<Fn>, details::no_idle_eviction, false>{std::forward<KeySelector>(key_selector),
+                                                                                                                                                      std::forward<InitialValue>(initial_value),
+                                                                                                                                                      std::forward<Fn>(accumulator),
+                                                                                                                                                      details::no_idle_eviction{}};
+    }
+
+    /**
+     * @brief Same as rpp::operators::reduce_by_key, but emits final accumulator of key (and forgets it) when key was not updated for `idle_timeout`.
+     * @details Idle keys are evicted lazily during emissions: whole map is swept not more often than once per `idle_timeout`, so, key can live up to two `idle_timeout` after last update. All keys left are emitted on completion.
+     *
+     * @param key_selector is function which returns key for provided value. Result of this function should be hashable.
+     * @param initial_value initial value for accumulator of each new key.
+     * @param accumulator function which accepts accumulator of key and new value from observable and return new value of accumulator. Can accept accumulator by move-reference.
+     * @param idle_timeout is duration after last update when accumulator of key can be emitted and evicted
+     * @param scheduler is scheduler used to obtain current time
+     *
+     * @warning #include <rpp/operators/scan_by_key.hpp>
+     *
+     * @ingroup aggregate_operators
+     * @see https://reactivex.io/documentation/operators/reduce.html
+     */
+    template<typename KeySelector, typename InitialValue, typename Fn, rpp::schedulers::constraint::scheduler Scheduler>
+        requires (!utils::is_not_template_callable<Fn> || std::same_as<std::decay_t<InitialValue>, std::invoke_result_t<Fn, std::decay_t<InitialValue> &&, rpp::utils::convertible_to_any>>)
+    auto reduce_by_key(KeySelector&& key_selector, InitialValue&& initial_value, Fn&& accumulator, rpp::schedulers::duration idle_timeout, const Scheduler& /*scheduler*/)
+    {
+        using eviction = details::idle_eviction<rpp::schedulers::utils::get_worker_t<Scheduler>>;
+        return details::accumulate_by_key_t<std::decay_t<KeySelector>, std::decay_t<InitialValue>, std::decay_t<Fn>, eviction, false>{std::forward<KeySelector>(key_selector),
+                                                                                                                                      std::forward<InitialValue>(initial_value),
+                                                                                                                                      std::forward<Fn>(accumulator),
+                                                                                                                                      eviction{idle_timeout}};
+    }
+} // namespace rpp::operators
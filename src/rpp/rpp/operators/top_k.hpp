@@ -0,0 +1,84 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/operators/fwd.hpp>
+
+#include <rpp/operators/details/sketch_strategy.hpp>
+#include <rpp/utils/sketches.hpp>
+
+namespace rpp::operators::details
+{
+    struct top_k_policy
+    {
+        size_t k;
+        size_t capacity;
+
+        template<rpp::constraint::decayed_type T>
+        rpp::utils::space_saving<T> make() const
+        {
+            static_assert(rpp::constraint::hashable<T>, "T is not hashable");
+            return rpp::utils::space_saving<T>{std::max(k, capacity)};
+        }
+
+        template<rpp::constraint::decayed_type T>
+        std::vector<std::pair<T, size_t>> result(const rpp::utils::space_saving<T>& sketch) const
+        {
+            return sketch.top(k);
+        }
+    };
+} // namespace rpp::operators::details
+
+namespace rpp::operators
+{
+    /**
+     * @brief Emits `k` most frequent values emitted by observable with their approximate counts (as `std::vector<std::pair<T, size_t>>` in descending order of count) when it completes.
+     *
+     * @marble top_k
+     {
+         source observable   : +--1-2-1-3-1-2-|
+         operator "top_k(2)" : +--------------{1,2}|
+     }
+     *
+     * @details Marble shows only values, actually each of them is paired with its count.
+     * @details Actually this operator keeps `capacity` counters (Space-Saving algorithm): in case of new value when all counters are busy, the least frequent counter is reused for new value. So, memory is bounded by `capacity`, count of any value is overestimated not more than `total amount of emissions / capacity` and any value with frequency greater than that is guaranteed to be in the result.
+     * @details Can be used as per-window aggregate too: `window(...) | flat_map([](auto w) { return w | top_k(10); })`
+     *
+     * @par Performance notes:
+     * - No heap allocations after all counters are occupied
+     * - O(log capacity) for each emission
+     *
+     * @param k is amount of values to emit
+     * @param capacity is amount of counters to keep. Greater capacity gives better precision. Can't be less than `k`.
+     *
+     * @warning #include <rpp/operators/top_k.hpp>
+     *
+     * @ingroup aggregate_operators
+     */
+    inline auto top_k(size_t k, size_t capacity)
+    {
+        return details::sketch_t<details::top_k_policy>{details::top_k_policy{k, capacity}};
+    }
+
+    /**
+     * @brief Same as rpp::operators::top_k, but with `4*k` counters.
+     *
+     * @param k is amount of values to emit
+     *
+     * @warning #include <rpp/operators/top_k.hpp>
+     *
+     * @ingroup aggregate_operators
+     */
+    inline auto top_k(size_t k)
+    {
+        return top_k(k, 4 * k);
+    }
+} // namespace rpp::operators
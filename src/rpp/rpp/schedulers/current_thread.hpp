@@ -180,6 +180,8 @@ namespace rpp::schedulers
 
             static constexpr rpp::schedulers::details::none_disposable get_disposable() { return {}; }
 
+            static constexpr bool is_caller_thread_only = true;
+
             static rpp::schedulers::time_point now() { return details::now(); }
         };
 
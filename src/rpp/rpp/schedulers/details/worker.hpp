@@ -16,6 +16,8 @@
 #include <rpp/disposables/disposable_wrapper.hpp>
 #include <rpp/utils/constraints.hpp>
 
+#include <concepts>
+
 namespace rpp::schedulers
 {
     template<rpp::schedulers::constraint::strategy Strategy>
@@ -56,6 +58,19 @@ namespace rpp::schedulers
                 schedule(tp - now(), std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
         }
 
+        /**
+         * @brief Invokes `fn` immediately if caller is already executing inside execution context of this worker (and strategy supports such an detection)
+         * @return true if `fn` was invoked, false if caller should schedule it as usual
+         */
+        template<std::invocable Fn>
+        bool execute_inline_if_current_thread(Fn&& fn) const
+        {
+            if constexpr (is_inline_execution_supported)
+                return m_strategy.execute_inline_if_current_thread(std::forward<Fn>(fn));
+            else
+                return false;
+        }
+
         rpp::disposable_wrapper get_disposable() const
         {
             if constexpr (is_none_disposable)
@@ -66,7 +81,9 @@ namespace rpp::schedulers
 
         static rpp::schedulers::time_point now() { return Strategy::now(); }
 
-        static constexpr bool is_none_disposable = std::same_as<decltype(std::declval<Strategy>().get_disposable()), rpp::schedulers::details::none_disposable>;
+        static constexpr bool is_inline_execution_supported = constraint::inline_execution_strategy<Strategy>;
+        static constexpr bool is_none_disposable            = std::same_as<decltype(std::declval<Strategy>().get_disposable()), rpp::schedulers::details::none_disposable>;
+        static constexpr bool is_caller_thread_only         = constraint::caller_thread_strategy<Strategy>;
 
     private:
         RPP_NO_UNIQUE_ADDRESS Strategy m_strategy;
@@ -147,6 +147,18 @@ namespace rpp::schedulers::constraint
         } -> std::same_as<void>;
     };
 
+    // strategy is able to detect that caller is already executing inside its execution context and to run `fn` immediately without scheduling
+    template<typename S>
+    concept inline_execution_strategy = requires(const S& s, void (*fn)()) {
+        {
+            s.execute_inline_if_current_thread(fn)
+        } -> std::same_as<bool>;
+    };
+
+    // strategy executes schedulables only in thread of caller (immediately or via queue of this thread), so, state touched by schedulables is never shared among threads
+    template<typename S>
+    concept caller_thread_strategy = requires { requires S::is_caller_thread_only; };
+
     template<typename S>
     concept strategy = (defer_for_strategy<S> || defer_to_strategy<S>)&&requires(const S& s, const details::fake_schedulable_handler& handler) {
         {
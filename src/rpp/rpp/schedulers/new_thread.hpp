@@ -25,14 +25,46 @@ namespace rpp::schedulers
      * @brief Scheduler which schedules invoking of schedulables to another thread via queueing tasks with priority to time_point and order
      * @warning Creates new thread for each "create_worker" call, but not for each schedule
      * @details This scheduler useful when we want to have separate thread for processing starting from some timepoint.
+     * @details Disposing of worker blocks caller till end of currently executing schedulable (thread is joined). In case of you don't want to wait, use `rpp::schedulers::new_thread::async_dispose` instead.
      * @ingroup schedulers
      */
     class new_thread
     {
+        class threads_tracker
+        {
+        public:
+            void on_thread_started()
+            {
+                std::lock_guard lock{m_mutex};
+                ++m_active_threads;
+            }
+
+            void on_thread_finished()
+            {
+                {
+                    std::lock_guard lock{m_mutex};
+                    --m_active_threads;
+                }
+                m_cv.notify_all();
+            }
+
+            void wait_all_threads_finished()
+            {
+                std::unique_lock lock{m_mutex};
+                m_cv.wait(lock, [&] { return m_active_threads == 0; });
+            }
+
+        private:
+            std::mutex              m_mutex{};
+            std::condition_variable m_cv{};
+            size_t                  m_active_threads{};
+        };
+
         class disposable final : public rpp::details::base_disposable
         {
         public:
-            disposable()
+            explicit disposable(std::shared_ptr<threads_tracker> tracker = {})
+                : m_state{init_state(std::move(tracker))}
             {
                 // just waiting
                 while (!m_state->queue_ptr.load(std::memory_order::seq_cst))
@@ -73,7 +105,10 @@ namespace rpp::schedulers
                 m_state->is_disposed.store(true, std::memory_order::seq_cst);
                 m_state->cv.notify_all();
 
-                if (m_thread.get_id() != std::this_thread::get_id())
+                // thread finishes current schedulable and cleans up everything by itself
+                if (m_state->tracker)
+                    m_thread.detach();
+                else if (m_thread.get_id() != std::this_thread::get_id())
                     m_thread.join();
                 else
                     m_thread.detach();
@@ -84,10 +119,38 @@ namespace rpp::schedulers
                 std::atomic<details::schedulables_queue<current_thread::worker_strategy>*> queue_ptr{};
                 std::atomic_bool                                                           is_disposed{};
                 std::atomic_bool                                                           is_destroying{};
+                std::shared_ptr<threads_tracker>                                           tracker{};
+            };
+
+            static std::shared_ptr<state_t> init_state(std::shared_ptr<threads_tracker> tracker)
+            {
+                auto state = std::make_shared<state_t>();
+                if (tracker)
+                    tracker->on_thread_started();
+                state->tracker = std::move(tracker);
+                return state;
+            }
+
+            /**
+             * @brief Notifies tracker about finish of thread from its destructor
+             */
+            struct finish_notifier
+            {
+                std::shared_ptr<threads_tracker> tracker{};
+
+                ~finish_notifier() noexcept
+                {
+                    if (tracker)
+                        tracker->on_thread_finished();
+                }
             };
 
             static void data_thread(std::shared_ptr<state_t> state)
             {
+                // thread_local objects are destroyed in reverse order of construction, so, this one is constructed first to be destroyed as the very last act of thread: after state and all other thread_local objects (like queue of current_thread)
+                thread_local finish_notifier notifier{};
+                notifier.tracker = state->tracker;
+
                 auto& queue = current_thread::s_queue;
                 state->queue_ptr.store(&queue.emplace(state), std::memory_order::seq_cst);
 
@@ -125,13 +188,15 @@ namespace rpp::schedulers
                         queue->emplace(timepoint.value(), std::move(top));
                 }
 
-                std::unique_lock lock{state->mutex};
-                state->queue_ptr.store(nullptr, std::memory_order::seq_cst);
-                queue.reset();
+                {
+                    std::unique_lock lock{state->mutex};
+                    state->queue_ptr.store(nullptr, std::memory_order::seq_cst);
+                    queue.reset();
+                }
             }
 
         private:
-            std::shared_ptr<state_t> m_state = std::make_shared<state_t>();
+            std::shared_ptr<state_t> m_state;
             std::thread              m_thread{&data_thread, m_state};
         };
 
@@ -141,6 +206,11 @@ namespace rpp::schedulers
         public:
             worker_strategy() = default;
 
+            explicit worker_strategy(std::shared_ptr<threads_tracker> tracker)
+                : m_state{disposable_wrapper_impl<disposable>::make(std::move(tracker))}
+            {
+            }
+
             template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
             void defer_to(time_point tp, Fn&& fn, Handler&& handler, Args&&... args) const
             {
@@ -159,5 +229,34 @@ namespace rpp::schedulers
         {
             return rpp::schedulers::worker<worker_strategy>{};
         }
+
+        /**
+         * @brief Same as `rpp::schedulers::new_thread`, but disposing of worker doesn't block caller.
+         * @details Disposing just marks worker as disposed, wakes its thread and returns immediately. Thread finishes currently executing schedulable (if any), destroys rest of the queue and exits by itself in background.
+         * @details Use `wait_all_threads_finished()` in case of you need to be sure that all threads of this scheduler (and its copies) are finished, for example, in tests.
+         *
+         * @par Example
+         * @code{.cpp}
+         * rpp::source::just(1, 2, 3) | rpp::operators::observe_on(rpp::schedulers::new_thread::async_dispose{}) | ...
+         * @endcode
+         *
+         * @ingroup schedulers
+         */
+        class async_dispose
+        {
+        public:
+            rpp::schedulers::worker<worker_strategy> create_worker() const
+            {
+                return rpp::schedulers::worker<worker_strategy>{m_tracker};
+            }
+
+            void wait_all_threads_finished() const
+            {
+                m_tracker->wait_all_threads_finished();
+            }
+
+        private:
+            std::shared_ptr<threads_tracker> m_tracker = std::make_shared<threads_tracker>();
+        };
     };
 } // namespace rpp::schedulers
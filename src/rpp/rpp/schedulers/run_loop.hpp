@@ -18,6 +18,16 @@
 #include <rpp/schedulers/details/queue.hpp>
 #include <rpp/schedulers/details/worker.hpp>
 #include <rpp/utils/functors.hpp>
+#include <rpp/utils/utils.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
 
 namespace rpp::schedulers
 {
@@ -25,91 +35,258 @@ namespace rpp::schedulers
      * @brief scheduler which schedules execution via queueing tasks, but execution of tasks should be manually dispatched
      * @warning you need manually dispatch events for this scheduler in some thread.
      *
+     * @details Same run_loop can be dispatched by multiple threads simultaneously. Each worker is bound to one of the internal shards (queues) and
+     * each shard is dispatched by at most one thread at a time, so tasks of same worker are never executed concurrently and keep their order.
+     * Amount of shards limits how many threads can execute tasks in parallel: default run_loop has only one shard, so multiple dispatching threads would be serialized.
+     * Task can call `dispatch()` of its own run_loop: nested dispatching executes tasks of shard already owned by this thread (as well as tasks of free shards).
+     *
+     * @details Workers of run_loop can detect that caller is already executing inside dispatching of same shard of this run_loop. In this case, if there are no other queued tasks in this shard, operators like `observe_on` execute their work inline instead of scheduling it.
+     * Amount of such an elided hops can be obtained via `get_elided_hops_count()`.
+     *
+     * @par Example
+     * @code{.cpp}
+     * auto run_loop = rpp::schedulers::run_loop{4}; // up to 4 threads can execute tasks in parallel
+     * @endcode
+     *
      * @ingroup schedulers
      */
     class run_loop final
     {
+    public:
+        // limits recursion of inline executions on the same thread. When limit is reached, caller falls back to regular scheduling (trampoline)
+        static constexpr size_t max_inline_depth = 16;
+
+    private:
         class worker_strategy;
 
         class state_t final : public rpp::details::base_disposable
         {
+            struct shard_t
+            {
+                std::mutex                                   mutex{};
+                details::schedulables_queue<worker_strategy> queue{};
+                bool                                         is_dispatching{};
+            };
+
         public:
+            struct popped_schedulable
+            {
+                std::shared_ptr<details::schedulable_base> schedulable{};
+                size_t                                     shard_index{};
+                // shard was already dispatched by this thread: `dispatch()` was called from one of its tasks
+                bool is_nested{};
+            };
+
+            explicit state_t(size_t shards_count)
+                : m_shards(std::max(shards_count, size_t{1}))
+            {
+            }
+
             ~state_t() noexcept override { dispose(); }
 
+            size_t next_worker_shard()
+            {
+                return m_next_worker_shard.fetch_add(1, std::memory_order::relaxed) % m_shards.size();
+            }
+
             template<typename... Args>
-            void emplace_and_notify(time_point timepoint, Args&&... args)
+            void emplace_and_notify(size_t shard_index, time_point timepoint, Args&&... args)
             {
                 if (is_disposed())
                     return;
 
                 {
-                    std::lock_guard lock{m_mutex};
-                    m_queue.emplace(timepoint, std::forward<Args>(args)...);
+                    auto&           shard = m_shards[shard_index];
+                    std::lock_guard lock{shard.mutex};
+                    shard.queue.emplace(timepoint, std::forward<Args>(args)...);
+                    // dispatching thread would notify others after finishing of current schedulable
+                    if (shard.is_dispatching)
+                        return;
                 }
-                m_cv.notify_one();
+                notify();
             }
 
-            std::shared_ptr<details::schedulable_base> pop(bool wait)
+            popped_schedulable pop(bool wait)
             {
                 while (!is_disposed())
                 {
-                    std::unique_lock lock{m_mutex};
-                    m_cv.wait(lock, [&] { return !wait || is_disposed() || !m_queue.is_empty(); });
+                    const auto version = m_version.load(std::memory_order::seq_cst);
+                    const auto now     = worker_strategy::now();
 
-                    if (is_disposed())
-                        break;
+                    std::optional<time_point> nearest_timepoint{};
+                    const size_t              offset = m_next_dispatch_shard.fetch_add(1, std::memory_order::relaxed);
+                    for (size_t i = 0; i < m_shards.size(); ++i)
+                    {
+                        const size_t    index = (offset + i) % m_shards.size();
+                        auto&           shard = m_shards[index];
+                        std::lock_guard lock{shard.mutex};
+                        const bool is_owned = shard.is_dispatching && is_dispatched_by_current_thread(index);
+                        if ((shard.is_dispatching && !is_owned) || shard.queue.is_empty())
+                            continue;
 
-                    const auto now = worker_strategy::now();
-                    if (is_any_ready_schedulable_unsafe(now))
-                        return m_queue.pop();
+                        if (is_ready_unsafe(shard, now))
+                        {
+                            shard.is_dispatching = true;
+                            return {shard.queue.pop(), index, is_owned};
+                        }
+
+                        const auto timepoint = shard.queue.top()->get_timepoint();
+                        if (!nearest_timepoint || timepoint < nearest_timepoint.value())
+                            nearest_timepoint = timepoint;
+                    }
 
                     if (!wait)
                         break;
 
-                    m_cv.wait_for(lock, m_queue.top()->get_timepoint() - now, [&]() { return is_disposed() || !m_queue.is_empty() || m_queue.top()->get_timepoint() <= worker_strategy::now(); });
+                    std::unique_lock lock{m_wait_mutex};
+                    m_sleepers.fetch_add(1, std::memory_order::seq_cst);
+                    const auto predicate = [&] { return is_disposed() || m_version.load(std::memory_order::seq_cst) != version; };
+                    if (nearest_timepoint)
+                        m_cv.wait_for(lock, nearest_timepoint.value() - now, predicate);
+                    else
+                        m_cv.wait(lock, predicate);
+                    m_sleepers.fetch_sub(1, std::memory_order::seq_cst);
                 }
                 return {};
             }
 
+            void finish_dispatching(popped_schedulable&& popped, std::optional<time_point> timepoint)
+            {
+                bool has_more{};
+                {
+                    auto&           shard = m_shards[popped.shard_index];
+                    std::lock_guard lock{shard.mutex};
+                    if (timepoint && !is_disposed())
+                        shard.queue.emplace(timepoint.value(), std::move(popped.schedulable));
+                    // outer dispatching of this thread still owns shard
+                    if (!popped.is_nested)
+                        shard.is_dispatching = false;
+                    has_more = !shard.queue.is_empty();
+                }
+                if (has_more)
+                    notify();
+            }
+
+            std::optional<time_point> execute_schedulable(size_t shard_index, details::schedulable_base& schedulable) const
+            {
+                const auto* prev_state = std::exchange(s_dispatching_state, this);
+                const auto  prev_shard = std::exchange(s_dispatching_shard, shard_index);
+                const auto  res        = schedulable();
+                s_dispatching_state    = prev_state;
+                s_dispatching_shard    = prev_shard;
+                return res;
+            }
+
+            template<typename Fn>
+            bool execute_inline_if_current_thread(size_t shard_index, Fn&& fn)
+            {
+                if (!is_dispatched_by_current_thread(shard_index) || s_inline_depth >= max_inline_depth)
+                    return false;
+
+                // inline execution must not overtake already queued tasks of same worker
+                {
+                    std::lock_guard lock{m_shards[shard_index].mutex};
+                    if (!m_shards[shard_index].queue.is_empty())
+                        return false;
+                }
+
+                ++s_inline_depth;
+                {
+                    rpp::utils::finally_action guard{[] { --s_inline_depth; }};
+                    std::forward<Fn>(fn)();
+                }
+                m_elided_hops_count.fetch_add(1, std::memory_order::relaxed);
+                return true;
+            }
+
+            size_t get_elided_hops_count() const
+            {
+                return m_elided_hops_count.load(std::memory_order::relaxed);
+            }
+
             bool is_any_ready_schedulable()
             {
-                std::lock_guard lock{m_mutex};
-                return is_any_ready_schedulable_unsafe();
+                const auto now = worker_strategy::now();
+                for (auto& shard : m_shards)
+                {
+                    std::lock_guard lock{shard.mutex};
+                    if (is_ready_unsafe(shard, now))
+                        return true;
+                }
+                return false;
             }
 
             bool is_empty()
             {
-                std::lock_guard lock{m_mutex};
-                return m_queue.is_empty();
+                for (auto& shard : m_shards)
+                {
+                    std::lock_guard lock{shard.mutex};
+                    if (!shard.queue.is_empty())
+                        return false;
+                }
+                return true;
             }
 
         private:
-            bool is_any_ready_schedulable_unsafe(time_point now = worker_strategy::now()) const
+            bool is_dispatched_by_current_thread(size_t shard_index) const
+            {
+                return s_dispatching_state == this && s_dispatching_shard == shard_index;
+            }
+
+            static bool is_ready_unsafe(const shard_t& shard, time_point now)
             {
-                return !m_queue.is_empty() && (m_queue.top()->is_disposed() || m_queue.top()->get_timepoint() <= now);
+                return !shard.queue.is_empty() && (shard.queue.top()->is_disposed() || shard.queue.top()->get_timepoint() <= now);
+            }
+
+            void notify()
+            {
+                m_version.fetch_add(1, std::memory_order::seq_cst);
+                // lock is needed only to not miss thread which is going to sleep right now
+                if (m_sleepers.load(std::memory_order::seq_cst) == 0)
+                    return;
+
+                {
+                    std::lock_guard lock{m_wait_mutex};
+                }
+                m_cv.notify_all();
             }
 
             void base_dispose_impl(interface_disposable::Mode) noexcept override
             {
+                for (auto& shard : m_shards)
+                {
+                    std::lock_guard lock{shard.mutex};
+                    shard.queue = details::schedulables_queue<worker_strategy>{};
+                }
                 {
-                    std::lock_guard lock{m_mutex};
-                    m_queue = details::schedulables_queue<worker_strategy>{};
+                    std::lock_guard lock{m_wait_mutex};
                 }
-                m_cv.notify_one();
+                m_cv.notify_all();
             }
 
         private:
-            std::mutex                                   m_mutex{};
-            details::schedulables_queue<worker_strategy> m_queue{};
+            inline static thread_local const state_t* s_dispatching_state{};
+            inline static thread_local size_t         s_dispatching_shard{};
+            inline static thread_local size_t         s_inline_depth{};
+
+            std::vector<shard_t> m_shards;
+            std::atomic<size_t>  m_next_worker_shard{};
+            std::atomic<size_t>  m_next_dispatch_shard{};
 
+            std::mutex              m_wait_mutex{};
             std::condition_variable m_cv{};
+            std::atomic<size_t>     m_version{};
+            std::atomic<size_t>     m_sleepers{};
+
+            std::atomic<size_t> m_elided_hops_count{};
         };
 
         class worker_strategy
         {
         public:
-            worker_strategy(const std::weak_ptr<state_t>& state)
+            worker_strategy(const std::shared_ptr<state_t>& state)
                 : m_state{state}
+                , m_shard_index{state->next_worker_shard()}
             {
             }
 
@@ -117,7 +294,15 @@ namespace rpp::schedulers
             void defer_to(time_point tp, Fn&& fn, Handler&& handler, Args&&... args) const
             {
                 if (const auto shared = m_state.lock())
-                    shared->emplace_and_notify(tp, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+                    shared->emplace_and_notify(m_shard_index, tp, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+            }
+
+            template<std::invocable Fn>
+            bool execute_inline_if_current_thread(Fn&& fn) const
+            {
+                if (const auto shared = m_state.lock())
+                    return shared->execute_inline_if_current_thread(m_shard_index, std::forward<Fn>(fn));
+                return false;
             }
 
             static constexpr rpp::schedulers::details::none_disposable get_disposable() { return {}; }
@@ -126,9 +311,20 @@ namespace rpp::schedulers
 
         private:
             std::weak_ptr<state_t> m_state;
+            size_t                 m_shard_index;
         };
 
     public:
+        run_loop() = default;
+
+        /**
+         * @param shards_count amount of independent queues. Workers are distributed between shards in round-robin manner and up to `shards_count` threads can dispatch tasks in parallel.
+         */
+        explicit run_loop(size_t shards_count)
+            : m_state{std::make_shared<state_t>(shards_count)}
+        {
+        }
+
         bool is_empty() const
         {
             return m_state->is_empty();
@@ -149,6 +345,14 @@ namespace rpp::schedulers
             dispatch_impl(true);
         }
 
+        /**
+         * @brief Amount of times when some operator (like `observe_on`) executed its work inline instead of scheduling it, because caller was already executing inside dispatching of same shard of this run_loop.
+         */
+        size_t get_elided_hops_count() const
+        {
+            return m_state->get_elided_hops_count();
+        }
+
         rpp::schedulers::worker<worker_strategy> create_worker() const
         {
             return rpp::schedulers::worker<worker_strategy>{m_state};
@@ -157,17 +361,18 @@ namespace rpp::schedulers
     private:
         void dispatch_impl(bool wait) const
         {
-            if (auto top = m_state->pop(wait))
-            {
-                if (top->is_disposed())
-                    return;
+            auto popped = m_state->pop(wait);
+            if (!popped.schedulable)
+                return;
 
-                if (const auto timepoint = (*top)())
-                    m_state->emplace_and_notify(timepoint.value(), std::move(top));
-            }
+            std::optional<time_point> timepoint{};
+            if (!popped.schedulable->is_disposed())
+                timepoint = m_state->execute_schedulable(popped.shard_index, *popped.schedulable);
+
+            m_state->finish_dispatching(std::move(popped), timepoint);
         }
 
     private:
-        std::shared_ptr<state_t> m_state = std::make_shared<state_t>();
+        std::shared_ptr<state_t> m_state = std::make_shared<state_t>(1);
     };
 } // namespace rpp::schedulers
@@ -26,4 +26,5 @@
 #include <rpp/sources/error.hpp>
 #include <rpp/sources/from.hpp>
 #include <rpp/sources/interval.hpp>
-#include <rpp/sources/never.hpp>
\ No newline at end of file
+#include <rpp/sources/never.hpp>
+#include <rpp/sources/ticker.hpp>
\ No newline at end of file
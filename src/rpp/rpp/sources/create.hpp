@@ -11,7 +11,13 @@
 
 #include <rpp/sources/fwd.hpp>
 
+#include <rpp/disposables/demand_disposable.hpp>
 #include <rpp/observables/observable.hpp>
+#include <rpp/observers/dynamic_observer.hpp>
+
+#include <functional>
+#include <memory>
+#include <mutex>
 
 namespace rpp::details
 {
@@ -23,10 +29,136 @@ namespace rpp::details
 
         RPP_NO_UNIQUE_ADDRESS OnSubscribe subscribe;
     };
+
+    template<constraint::decayed_type Type>
+    class create_on_demand_state final : public rpp::demand_disposable
+    {
+    public:
+        explicit create_on_demand_state(rpp::dynamic_observer<Type>&& in_observer)
+            : observer{std::move(in_observer)}
+        {
+        }
+
+        bool try_acquire() { return try_acquire_demand_or_suspend(); }
+
+        void set_on_demand_available(std::function<void()>&& fn)
+        {
+            std::lock_guard lock{m_mutex};
+            m_on_demand_available = std::move(fn);
+        }
+
+        rpp::dynamic_observer<Type> observer;
+
+    protected:
+        void on_demand_available() noexcept override
+        {
+            std::function<void()> fn{};
+            {
+                std::lock_guard lock{m_mutex};
+                fn = m_on_demand_available;
+            }
+            if (fn)
+                fn();
+        }
+
+        // callback usually keeps emitter (and this state as a result) -> release it to break cycle
+        void composite_dispose_impl(interface_disposable::Mode) noexcept override
+        {
+            std::function<void()> fn{};
+            {
+                std::lock_guard lock{m_mutex};
+                std::swap(fn, m_on_demand_available);
+            }
+        }
+
+    private:
+        std::mutex            m_mutex{};
+        std::function<void()> m_on_demand_available{};
+    };
+
+    template<constraint::decayed_type Type, std::invocable<const rpp::demand_emitter<Type>&> OnSubscribe>
+    struct create_on_demand_strategy
+    {
+        using value_type                   = Type;
+        using expected_disposable_strategy = rpp::details::observables::fixed_disposable_strategy_selector<1>;
+
+        RPP_NO_UNIQUE_ADDRESS OnSubscribe on_subscribe;
+
+        template<rpp::constraint::observer_of_type<value_type> TObs>
+        void subscribe(TObs&& observer) const
+        {
+            const auto d   = disposable_wrapper_impl<create_on_demand_state<Type>>::make(std::forward<TObs>(observer).as_dynamic());
+            auto       ptr = d.lock();
+            ptr->observer.set_upstream(d.as_weak());
+            on_subscribe(rpp::demand_emitter<Type>{std::move(ptr)});
+        }
+    };
 } // namespace rpp::details
 
 namespace rpp
 {
+    /**
+     * @brief Emitter passed to callback of rpp::source::create_on_demand. Emits items only when downstream requested them.
+     * @details Emitter is copyable and can be kept by producer to emit items later from any thread (but still in serial way).
+     *
+     * @ingroup creational_operators
+     */
+    template<constraint::decayed_type Type>
+    class demand_emitter
+    {
+    public:
+        explicit demand_emitter(std::shared_ptr<details::create_on_demand_state<Type>> state)
+            : m_state{std::move(state)}
+        {
+        }
+
+        /**
+         * @brief Emit item if downstream requested it
+         * @return false if item was not emitted due to lack of demand or disposing. In case of lack of demand callback passed to `on_demand_available` would be invoked on next request.
+         */
+        bool offer(const Type& v) const
+        {
+            if (m_state->is_disposed() || !m_state->try_acquire())
+                return false;
+            m_state->observer.on_next(v);
+            return true;
+        }
+
+        bool offer(Type&& v) const
+        {
+            if (m_state->is_disposed() || !m_state->try_acquire())
+                return false;
+            m_state->observer.on_next(std::move(v));
+            return true;
+        }
+
+        void on_error(const std::exception_ptr& err) const
+        {
+            m_state->observer.on_error(err);
+            m_state->dispose();
+        }
+
+        void on_completed() const
+        {
+            m_state->observer.on_completed();
+            m_state->dispose();
+        }
+
+        bool is_disposed() const { return m_state->is_disposed(); }
+
+        /**
+         * @brief Set callback invoked (from thread of requester) when downstream requests new items after failed `offer`. Producer is expected to resume offering items from this callback.
+         */
+        template<std::invocable<> Fn>
+        void on_demand_available(Fn&& fn) const
+        {
+            m_state->set_on_demand_available(std::function<void()>{std::forward<Fn>(fn)});
+        }
+
+    private:
+        std::shared_ptr<details::create_on_demand_state<Type>> m_state;
+    };
+
     template<constraint::decayed_type Type, constraint::on_subscribe<Type> OnSubscribe>
     using create_observable = observable<Type, details::create_strategy<Type, OnSubscribe>>;
 } // namespace rpp
@@ -90,4 +222,29 @@ namespace rpp::source
     {
         return create<Type>(std::forward<OnSubscribe>(on_subscribe));
     }
+
+    /**
+     * @brief Construct observable emitting items only on demand of downstream (`request(n)` backpressure protocol).
+     * @details Callback obtains rpp::demand_emitter instead of observer. Each `offer` emits item only if downstream requested it, otherwise returns false: producer should stop and resume offering from callback passed to `on_demand_available`.
+     * @details In case of consumer which is not demand-aware every `offer` succeeds, so, observable behaves like regular rpp::source::create.
+     *
+     * @warning Be sure, that your callback doesn't violates observable rules:
+     * 1) observable must to emit emissions in serial way
+     * 2) observable must not to call any callbacks after termination events - on_error/on_completed
+     *
+     * @par Performance notes:
+     * - 1 heap allocation for state of subscription + observer is converted to rpp::dynamic_observer
+     * - Atomic acquiring of demand for each emission
+     *
+     * @tparam Type is type of values observable would emit
+     * @tparam OnSubscribe is callback function accepting `const rpp::demand_emitter<Type>&`
+     *
+     * @ingroup creational_operators
+     * @see https://reactivex.io/documentation/operators/backpressure.html
+     */
+    template<constraint::decayed_type Type, std::invocable<const rpp::demand_emitter<Type>&> OnSubscribe>
+    auto create_on_demand(OnSubscribe&& on_subscribe)
+    {
+        return observable<Type, details::create_on_demand_strategy<Type, std::decay_t<OnSubscribe>>>{std::forward<OnSubscribe>(on_subscribe)};
+    }
 } // namespace rpp::source
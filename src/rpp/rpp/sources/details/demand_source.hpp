@@ -0,0 +1,99 @@
+//                   ReactivePlusPlus library
+//
+//           Copyright Aleksey Loginov 2023 - present.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+//
+//  Project home: https://github.com/victimsnino/ReactivePlusPlus
+
+#pragma once
+
+#include <rpp/sources/fwd.hpp>
+
+#include <rpp/defs.hpp>
+#include <rpp/disposables/demand_disposable.hpp>
+#include <rpp/schedulers/fwd.hpp>
+
+#include <exception>
+#include <memory>
+
+namespace rpp::details
+{
+    /**
+     * @brief State of source emitting items on demand: emits items via `Derived::emit_next()` scheduled to worker and re-schedules it when demand appears after suspension.
+     * @details State keeps itself alive till termination or disposing due to nobody else keeps it while source is suspended.
+     */
+    template<typename Derived, rpp::constraint::observer TObserver, typename Worker>
+    class demand_source_state : public rpp::demand_disposable
+    {
+        struct handler
+        {
+            std::shared_ptr<Derived> state;
+
+            bool is_disposed() const noexcept { return state->is_disposed(); }
+
+            void on_error(const std::exception_ptr& err) const { state->on_error(err); }
+        };
+
+    public:
+        demand_source_state(TObserver&& in_observer, Worker&& in_worker)
+            : observer{std::move(in_observer)}
+            , worker{std::move(in_worker)}
+        {
+            if constexpr (!Worker::is_none_disposable)
+            {
+                if (auto d = worker.get_disposable(); !d.is_disposed())
+                    add(std::move(d));
+            }
+        }
+
+        template<typename... TimePointOrDuration>
+        static void start(const disposable_wrapper_impl<Derived>& disposable, const TimePointOrDuration&... when)
+        {
+            auto ptr         = disposable.lock();
+            ptr->m_self      = ptr;
+            ptr->m_weak_self = ptr;
+            ptr->observer.set_upstream(disposable.as_weak());
+            ptr->schedule(std::move(ptr), when...);
+        }
+
+        void on_error(const std::exception_ptr& err)
+        {
+            observer.on_error(err);
+            dispose();
+        }
+
+        void on_completed()
+        {
+            observer.on_completed();
+            dispose();
+        }
+
+        TObserver                    observer;
+        RPP_NO_UNIQUE_ADDRESS Worker worker;
+
+    protected:
+        void on_demand_available() noexcept override
+        {
+            if (auto self = m_weak_self.lock())
+                schedule(std::move(self));
+        }
+
+        void composite_dispose_impl(interface_disposable::Mode) noexcept override
+        {
+            m_self.reset();
+        }
+
+    private:
+        template<typename... TimePointOrDuration>
+        void schedule(std::shared_ptr<Derived>&& self, const TimePointOrDuration&... when) const
+        {
+            worker.schedule(when..., [](const handler& h) { return h.state->emit_next(); }, handler{std::move(self)});
+        }
+
+    private:
+        std::shared_ptr<Derived> m_self{};
+        std::weak_ptr<Derived>   m_weak_self{};
+    };
+} // namespace rpp::details
@@ -15,6 +15,7 @@
 #include <rpp/observables/observable.hpp>
 #include <rpp/operators/map.hpp>
 #include <rpp/schedulers/current_thread.hpp>
+#include <rpp/sources/details/demand_source.hpp>
 #include <rpp/utils/utils.hpp>
 
 #include <array>
@@ -132,6 +133,72 @@ namespace rpp::details
         }
     };
 
+    template<constraint::decayed_type PackedContainer, rpp::constraint::observer TObserver, typename Worker>
+    class from_iterable_on_demand_state final : public demand_source_state<from_iterable_on_demand_state<PackedContainer, TObserver, Worker>, TObserver, Worker>
+    {
+        using base = demand_source_state<from_iterable_on_demand_state<PackedContainer, TObserver, Worker>, TObserver, Worker>;
+
+    public:
+        from_iterable_on_demand_state(TObserver&& observer, const PackedContainer& container, Worker&& worker)
+            : base{std::move(observer), std::move(worker)}
+            , m_container{container}
+        {
+        }
+
+        rpp::schedulers::optional_delay_from_now emit_next()
+        {
+            auto itr = std::cbegin(m_container);
+            auto end = std::cend(m_container);
+            std::advance(itr, static_cast<int64_t>(m_index));
+
+            if (itr != end)
+            {
+                if (!base::try_acquire_demand_or_suspend())
+                    return std::nullopt;
+
+                base::observer.on_next(utils::as_const(*itr));
+                if (std::next(itr) != end) // it was not last
+                {
+                    ++m_index;
+                    return schedulers::delay_from_now{}; // re-schedule this
+                }
+            }
+
+            base::on_completed();
+            return std::nullopt;
+        }
+
+    private:
+        RPP_NO_UNIQUE_ADDRESS PackedContainer m_container;
+        size_t                                m_index{};
+    };
+
+    template<constraint::decayed_type PackedContainer, schedulers::constraint::scheduler TScheduler>
+    struct from_iterable_on_demand_strategy
+    {
+    public:
+        using value_type                   = rpp::utils::iterable_value_t<PackedContainer>;
+        using expected_disposable_strategy = rpp::details::observables::fixed_disposable_strategy_selector<1>;
+
+        template<typename... Args>
+        from_iterable_on_demand_strategy(const TScheduler& scheduler, Args&&... args)
+            : container{std::forward<Args>(args)...}
+            , scheduler{scheduler}
+        {
+        }
+
+        RPP_NO_UNIQUE_ADDRESS PackedContainer container;
+        RPP_NO_UNIQUE_ADDRESS TScheduler      scheduler;
+
+        template<rpp::constraint::observer_of_type<value_type> TObs>
+        void subscribe(TObs&& observer) const
+        {
+            using state_t = from_iterable_on_demand_state<PackedContainer, std::decay_t<TObs>, rpp::schedulers::utils::get_worker_t<TScheduler>>;
+
+            state_t::start(disposable_wrapper_impl<state_t>::make(std::forward<TObs>(observer), container, scheduler.create_worker()));
+        }
+    };
+
     template<typename PackedContainer, schedulers::constraint::scheduler TScheduler, typename... Args>
     auto make_from_iterable_observable(const TScheduler& scheduler, Args&&... args)
     {
@@ -186,6 +253,28 @@ namespace rpp::source
         return details::make_from_iterable_observable<container>(scheduler, std::forward<Iterable>(iterable));
     }
 
+    /**
+     * @brief Same as rpp::source::from_iterable, but emits items only on demand of downstream (`request(n)` backpressure protocol)
+     * @details In case of demand-aware consumer (for example, rpp::operators::observe_on_bounded) observable emits no more items than were requested by consumer and pauses emissions till next request. In case of any other consumer it behaves like regular rpp::source::from_iterable.
+     *
+     * @par Performance notes:
+     * - 1 heap allocation for state of subscription
+     * - Atomic acquiring of demand for each emission
+     *
+     * @tparam memory_model rpp::memory_model strategy used to handle provided iterable
+     * @param scheduler is scheduler used for scheduling of submissions: next item will be submitted to scheduler when previous one is executed and there is demand for it
+     * @param iterable container with values which will be flattened
+     *
+     * @ingroup creational_operators
+     * @see https://reactivex.io/documentation/operators/backpressure.html
+     */
+    template<constraint::memory_model MemoryModel /* = memory_model::use_stack*/, constraint::iterable Iterable, schedulers::constraint::scheduler TScheduler /* = rpp::schedulers::defaults::iteration_scheduler*/>
+    auto from_iterable_on_demand(Iterable&& iterable, const TScheduler& scheduler /* = TScheduler{}*/)
+    {
+        using container = std::conditional_t<std::same_as<MemoryModel, rpp::memory_model::use_stack>, std::decay_t<Iterable>, details::shared_container<std::decay_t<Iterable>>>;
+        return observable<utils::iterable_value_t<container>, details::from_iterable_on_demand_strategy<container, TScheduler>>{scheduler, std::forward<Iterable>(iterable)};
+    }
+
     /**
      * @brief Creates rpp::observable that emits a particular items and completes
      *
@@ -31,17 +31,29 @@ namespace rpp::constraint
     };
 } // namespace rpp::constraint
 
+namespace rpp
+{
+    template<constraint::decayed_type Type>
+    class demand_emitter;
+} // namespace rpp
+
 namespace rpp::source
 {
     template<constraint::decayed_type Type, constraint::on_subscribe<Type> OnSubscribe>
     auto create(OnSubscribe&& on_subscribe);
 
+    template<constraint::decayed_type Type, std::invocable<const rpp::demand_emitter<Type>&> OnSubscribe>
+    auto create_on_demand(OnSubscribe&& on_subscribe);
+
     template<utils::is_not_template_callable OnSubscribe, constraint::decayed_type Type = rpp::utils::extract_observer_type_t<rpp::utils::decayed_function_argument_t<OnSubscribe>>>
     auto create(OnSubscribe&& on_subscribe);
 
     template<constraint::memory_model MemoryModel = memory_model::use_stack, constraint::iterable Iterable, schedulers::constraint::scheduler TScheduler = rpp::schedulers::defaults::iteration_scheduler>
     auto from_iterable(Iterable&& iterable, const TScheduler& scheduler = TScheduler{});
 
+    template<constraint::memory_model MemoryModel = memory_model::use_stack, constraint::iterable Iterable, schedulers::constraint::scheduler TScheduler = rpp::schedulers::defaults::iteration_scheduler>
+    auto from_iterable_on_demand(Iterable&& iterable, const TScheduler& scheduler = TScheduler{});
+
     template<constraint::memory_model MemoryModel = memory_model::use_stack, typename T, typename... Ts>
         requires (constraint::decayed_same_as<T, Ts> && ...)
     auto just(T&& item, Ts&&... items);
@@ -80,6 +92,15 @@ namespace rpp::source
     template<schedulers::constraint::scheduler TScheduler>
     auto interval(rpp::schedulers::duration period, TScheduler&& scheduler);
 
+    template<schedulers::constraint::scheduler TScheduler>
+    auto interval_on_demand(rpp::schedulers::duration initial, rpp::schedulers::duration period, TScheduler&& scheduler);
+
+    template<schedulers::constraint::scheduler TScheduler>
+    auto interval_on_demand(rpp::schedulers::duration period, TScheduler&& scheduler);
+
+    template<schedulers::constraint::scheduler TScheduler>
+    class ticker;
+
     template<constraint::decayed_type Type>
     auto never();
 
@@ -13,6 +13,7 @@
 
 #include <rpp/defs.hpp>
 #include <rpp/observables/observable.hpp>
+#include <rpp/sources/details/demand_source.hpp>
 
 namespace rpp::details
 {
@@ -48,6 +49,52 @@ namespace rpp::details
             worker.schedule(initial, interval_schedulable{}, std::forward<TObs>(observer), period, size_t{});
         }
     };
+
+    template<rpp::constraint::observer TObserver, typename Worker>
+    class interval_on_demand_state final : public demand_source_state<interval_on_demand_state<TObserver, Worker>, TObserver, Worker>
+    {
+        using base = demand_source_state<interval_on_demand_state<TObserver, Worker>, TObserver, Worker>;
+
+    public:
+        interval_on_demand_state(TObserver&& observer, Worker&& worker, rpp::schedulers::duration period)
+            : base{std::move(observer), std::move(worker)}
+            , m_period{period}
+        {
+        }
+
+        rpp::schedulers::optional_delay_from_this_timepoint emit_next()
+        {
+            // tick without demand is not lost: it would be emitted right after next request
+            if (!base::try_acquire_demand_or_suspend())
+                return std::nullopt;
+
+            base::observer.on_next(m_counter++);
+            return rpp::schedulers::optional_delay_from_this_timepoint{m_period};
+        }
+
+    private:
+        rpp::schedulers::duration m_period;
+        size_t                    m_counter{};
+    };
+
+    template<typename TScheduler>
+    struct interval_on_demand_strategy
+    {
+        using value_type                   = size_t;
+        using expected_disposable_strategy = rpp::details::observables::fixed_disposable_strategy_selector<1>;
+
+        RPP_NO_UNIQUE_ADDRESS TScheduler scheduler;
+        rpp::schedulers::duration        initial;
+        rpp::schedulers::duration        period;
+
+        template<rpp::constraint::observer_of_type<value_type> TObs>
+        void subscribe(TObs&& observer) const
+        {
+            using state_t = interval_on_demand_state<std::decay_t<TObs>, rpp::schedulers::utils::get_worker_t<TScheduler>>;
+
+            state_t::start(disposable_wrapper_impl<state_t>::make(std::forward<TObs>(observer), scheduler.create_worker(), period), initial);
+        }
+    };
 } // namespace rpp::details
 
 namespace rpp
@@ -120,4 +167,40 @@ namespace rpp::source
     {
         return interval(period, period, std::forward<TScheduler>(scheduler));
     }
-} // namespace rpp::source
\ No newline at end of file
+
+    /**
+     * @brief Same as rpp::source::interval, but emits values only on demand of downstream (`request(n)` backpressure protocol)
+     * @details In case of demand-aware consumer (for example, rpp::operators::observe_on_bounded) tick happened without demand is not emitted, but observable pauses and emits it right after next request. Then emissions continue periodically from that moment. So, no values are lost and consumer never obtains more values than requested. In case of any other consumer it behaves like regular rpp::source::interval.
+     *
+     * @par Performance notes:
+     * - 1 heap allocation for state of subscription
+     * - Atomic acquiring of demand for each emission
+     *
+     * @param initial duration before first emission
+     * @param period period between emitted values
+     * @param scheduler the scheduler to use for scheduling the items
+     *
+     * @ingroup creational_operators
+     * @see https://reactivex.io/documentation/operators/backpressure.html
+     */
+    template<schedulers::constraint::scheduler TScheduler>
+    auto interval_on_demand(rpp::schedulers::duration initial, rpp::schedulers::duration period, TScheduler&& scheduler)
+    {
+        return observable<size_t, details::interval_on_demand_strategy<std::decay_t<TScheduler>>>{std::forward<TScheduler>(scheduler), initial, period};
+    }
+
+    /**
+     * @brief Same as rpp::source::interval_on_demand, but with initial delay equal to period
+     *
+     * @param period period between emitted values
+     * @param scheduler the scheduler to use for scheduling the items
+     *
+     * @ingroup creational_operators
+     * @see https://reactivex.io/documentation/operators/backpressure.html
+     */
+    template<schedulers::constraint::scheduler TScheduler>
+    auto interval_on_demand(rpp::schedulers::duration period, TScheduler&& scheduler)
+    {
+        return interval_on_demand(period, period, std::forward<TScheduler>(scheduler));
+    }
+} // namespace rpp::source
@@ -0,0 +1,304 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/sources/fwd.hpp>
+
+#include <rpp/defs.hpp>
+#include <rpp/disposables/callback_disposable.hpp>
+#include <rpp/observables/observable.hpp>
+#include <rpp/observers/dynamic_observer.hpp>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace rpp::details
+{
+    template<typename TScheduler>
+    class ticker_state;
+
+    struct ticker_subscriber
+    {
+        rpp::dynamic_observer<size_t> observer;
+        rpp::schedulers::time_point   start;
+        size_t                        counter{};
+    };
+
+    /**
+     * @brief Single periodic schedulable shared among all subscribers of the same period. It is started by the first subscriber (with its initial delay) and stops itself on the first tick without subscribers.
+     * @details Stopped group without subscribers is removed from its ticker, so, its worker is released till the next subscriber of this period.
+     */
+    template<typename TScheduler>
+    class ticker_group final : public std::enable_shared_from_this<ticker_group<TScheduler>>
+    {
+        using Worker      = rpp::schedulers::utils::get_worker_t<TScheduler>;
+        using subscribers = std::shared_ptr<const std::vector<std::shared_ptr<ticker_subscriber>>>;
+
+        struct handler
+        {
+            std::shared_ptr<ticker_group> group;
+
+            bool is_disposed() const noexcept { return false; }
+
+            void on_error(const std::exception_ptr& err) const { group->on_error(err); }
+        };
+
+    public:
+        ticker_group(std::weak_ptr<ticker_state<TScheduler>> state, Worker&& worker, rpp::schedulers::duration period)
+            : m_state{std::move(state)}
+            , m_worker{std::move(worker)}
+            , m_period{period}
+        {
+        }
+
+        /**
+         * @brief Marks group as used by subscription in progress: group is not removed from ticker till corresponding `add`
+         * @warning Called under lock of ticker
+         */
+        void acquire()
+        {
+            std::lock_guard lock{m_mutex};
+            ++m_pending_adds;
+        }
+
+        /**
+         * @warning Called under lock of ticker
+         */
+        bool is_idle()
+        {
+            std::lock_guard lock{m_mutex};
+            return !m_is_running && m_pending_adds == 0 && m_subscribers->empty();
+        }
+
+        void add(rpp::dynamic_observer<size_t>&& observer, rpp::schedulers::duration initial)
+        {
+            if (add_impl(std::move(observer), initial))
+                return;
+
+            // subscription was disposed immediately: group could become idle
+            release_if_idle();
+        }
+
+    private:
+        bool add_impl(rpp::dynamic_observer<size_t>&& observer, rpp::schedulers::duration initial)
+        {
+            auto subscriber = std::make_shared<ticker_subscriber>(std::move(observer), Worker::now() + initial);
+            // set upstream before subscriber is visible to ticking thread
+            subscriber->observer.set_upstream(rpp::disposable_wrapper{make_callback_disposable([weak = this->weak_from_this()]() noexcept {
+                if (const auto group = weak.lock())
+                    group->remove_disposed();
+            })});
+
+            {
+                std::lock_guard lock{m_mutex};
+                --m_pending_adds;
+                if (subscriber->observer.is_disposed())
+                    return false;
+
+                auto new_subscribers = std::make_shared<std::vector<std::shared_ptr<ticker_subscriber>>>(*m_subscribers);
+                new_subscribers->push_back(std::move(subscriber));
+                m_subscribers = std::move(new_subscribers);
+                if (std::exchange(m_is_running, true))
+                    return true;
+            }
+
+            m_worker.schedule(
+                initial,
+                [](const handler& h) -> rpp::schedulers::optional_delay_from_this_timepoint { return h.group->tick(); },
+                handler{this->shared_from_this()});
+            return true;
+        }
+
+        rpp::schedulers::optional_delay_from_this_timepoint tick()
+        {
+            subscribers subs{};
+            {
+                std::lock_guard lock{m_mutex};
+                subs = m_subscribers;
+                // next subscriber restarts ticking
+                if (subs->empty())
+                    m_is_running = false;
+            }
+
+            if (subs->empty())
+            {
+                release_if_idle();
+                return std::nullopt;
+            }
+
+            const auto now = Worker::now();
+            for (const auto& subscriber : *subs)
+            {
+                // subscriber joined in the middle of period obtains first value on the first tick after its own initial delay
+                if (subscriber->start <= now && !subscriber->observer.is_disposed())
+                    subscriber->observer.on_next(subscriber->counter++);
+            }
+            return rpp::schedulers::optional_delay_from_this_timepoint{m_period};
+        }
+
+        void on_error(const std::exception_ptr& err)
+        {
+            subscribers subs{};
+            {
+                std::lock_guard lock{m_mutex};
+                subs         = std::exchange(m_subscribers, std::make_shared<std::vector<std::shared_ptr<ticker_subscriber>>>());
+                m_is_running = false;
+            }
+            for (const auto& subscriber : *subs)
+                subscriber->observer.on_error(err);
+
+            release_if_idle();
+        }
+
+        void remove_disposed()
+        {
+            std::lock_guard lock{m_mutex};
+            auto            new_subscribers = std::make_shared<std::vector<std::shared_ptr<ticker_subscriber>>>();
+            new_subscribers->reserve(m_subscribers->size());
+            std::copy_if(m_subscribers->cbegin(), m_subscribers->cend(), std::back_inserter(*new_subscribers), [](const auto& s) { return !s->observer.is_disposed(); });
+            m_subscribers = std::move(new_subscribers);
+        }
+
+        void release_if_idle()
+        {
+            if (const auto state = m_state.lock())
+                state->remove_group_if_idle(m_period, this);
+        }
+
+        const std::weak_ptr<ticker_state<TScheduler>> m_state;
+        RPP_NO_UNIQUE_ADDRESS Worker                 m_worker;
+        const rpp::schedulers::duration              m_period;
+
+        std::mutex  m_mutex{};
+        subscribers m_subscribers = std::make_shared<std::vector<std::shared_ptr<ticker_subscriber>>>();
+        size_t      m_pending_adds{};
+        bool        m_is_running{};
+    };
+
+    template<typename TScheduler>
+    class ticker_state final : public std::enable_shared_from_this<ticker_state<TScheduler>>
+    {
+        using group_t = ticker_group<TScheduler>;
+
+    public:
+        explicit ticker_state(const TScheduler& scheduler)
+            : m_scheduler{scheduler}
+        {
+        }
+
+        std::shared_ptr<group_t> acquire_group(rpp::schedulers::duration period)
+        {
+            std::lock_guard lock{m_mutex};
+            auto&           group = m_groups[period];
+            if (!group)
+                group = std::make_shared<group_t>(this->weak_from_this(), m_scheduler.create_worker(), period);
+            group->acquire();
+            return group;
+        }
+
+        /**
+         * @brief Removes stopped group without subscribers, so, its worker is released. Next subscriber of this period creates new group.
+         */
+        void remove_group_if_idle(rpp::schedulers::duration period, const group_t* group)
+        {
+            std::shared_ptr<group_t> removed{};
+            {
+                std::lock_guard lock{m_mutex};
+                const auto      itr = m_groups.find(period);
+                if (itr == m_groups.end() || itr->second.get() != group || !itr->second->is_idle())
+                    return;
+
+                removed = std::move(itr->second);
+                m_groups.erase(itr);
+            }
+            // group (and its worker) could be destroyed out of lock
+        }
+
+    private:
+        RPP_NO_UNIQUE_ADDRESS TScheduler                              m_scheduler;
+        std::mutex                                                    m_mutex{};
+        std::map<rpp::schedulers::duration, std::shared_ptr<group_t>> m_groups{};
+    };
+
+    template<typename TScheduler>
+    struct ticker_interval_strategy
+    {
+        using value_type                   = size_t;
+        using expected_disposable_strategy = rpp::details::observables::fixed_disposable_strategy_selector<1>;
+
+        std::shared_ptr<ticker_state<TScheduler>> state;
+        rpp::schedulers::duration                 initial;
+        rpp::schedulers::duration                 period;
+
+        template<rpp::constraint::observer_of_type<value_type> TObs>
+        void subscribe(TObs&& observer) const
+        {
+            state->acquire_group(period)->add(std::forward<TObs>(observer).as_dynamic(), initial);
+        }
+    };
+} // namespace rpp::details
+
+namespace rpp::source
+{
+    /**
+     * @brief Source of interval observables sharing timers: all subscriptions to intervals with the same period obtained from the same ticker (or its copies) are served by one periodic schedulable on one worker of `scheduler`.
+     *
+     * @details Each subscriber obtains its own sequence of integers starting from 0 like with rpp::source::interval. Shared schedulable is started by the first subscriber with its initial delay and then ticks with period, so, first subscriber obtains values exactly like with rpp::source::interval. Each next subscriber obtains its first value on the first tick happened not earlier than its own initial delay after subscription, so, its values are aligned with ticks of the shared schedulable (and could be late for less than one period).
+     * @details Shared schedulable stops on the first tick without subscribers and its worker is released, next subscriber of this period obtains new worker. Amount of workers is limited by amount of distinct periods having subscribers.
+     *
+     * @par Performance notes:
+     * - Amount of timers (schedulables) is one per distinct period instead of one per subscription
+     * - 1 heap allocation per subscription, mutex is acquired only on subscription/unsubscription and once per tick
+     * - All subscribers of the same period are emitted from the same worker one by one, so, slow subscriber delays others
+     *
+     * @tparam TScheduler is scheduler to obtain worker for each distinct period
+     *
+     * @par Example:
+     * @snippet interval.cpp ticker
+     *
+     * @ingroup creational_operators
+     * @see https://reactivex.io/documentation/operators/interval.html
+     */
+    template<schedulers::constraint::scheduler TScheduler>
+    class ticker
+    {
+    public:
+        explicit ticker(const TScheduler& scheduler = TScheduler{})
+            : m_state{std::make_shared<details::ticker_state<TScheduler>>(scheduler)}
+        {
+        }
+
+        /**
+         * @brief Creates rpp::observable that emits a sequential integer every specified time interval using timer shared with all other observables of this ticker with the same period.
+         *
+         * @param initial duration before first emission
+         * @param period period between emitted values
+         */
+        auto interval(rpp::schedulers::duration initial, rpp::schedulers::duration period) const
+        {
+            return observable<size_t, details::ticker_interval_strategy<TScheduler>>{m_state, initial, period};
+        }
+
+        /**
+         * @brief Same as above, but with initial delay equal to period
+         */
+        auto interval(rpp::schedulers::duration period) const
+        {
+            return interval(period, period);
+        }
+
+    private:
+        std::shared_ptr<details::ticker_state<TScheduler>> m_state;
+    };
+} // namespace rpp::source
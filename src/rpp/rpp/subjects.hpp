@@ -17,5 +17,8 @@
  * \ingroup rpp
  */
 
+#include <rpp/subjects/broadcast_subject.hpp>
+#include <rpp/subjects/keyed_subject.hpp>
+#include <rpp/subjects/mailbox_subject.hpp>
 #include <rpp/subjects/publish_subject.hpp>
 #include <rpp/subjects/replay_subject.hpp>
\ No newline at end of file
@@ -0,0 +1,512 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/subjects/fwd.hpp>
+
+#include <rpp/disposables/callback_disposable.hpp>
+#include <rpp/disposables/composite_disposable.hpp>
+#include <rpp/disposables/disposable_wrapper.hpp>
+#include <rpp/observers/dynamic_observer.hpp>
+#include <rpp/observers/observer.hpp>
+#include <rpp/schedulers/new_thread.hpp>
+#include <rpp/subjects/details/subject_on_subscribe.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <condition_variable>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace rpp::subjects::wait_strategy
+{
+    /**
+     * @brief Producer of rpp::subjects::broadcast_subject spins in tight loop while ring buffer is full. Lowest latency, but burns CPU core.
+     */
+    struct busy_spin
+    {
+        template<std::predicate Pred>
+        void wait_until(const Pred& pred)
+        {
+            while (!pred())
+            {
+            };
+        }
+
+        void notify() {}
+    };
+
+    /**
+     * @brief Producer of rpp::subjects::broadcast_subject yields its time slice while ring buffer is full.
+     */
+    struct yielding
+    {
+        template<std::predicate Pred>
+        void wait_until(const Pred& pred)
+        {
+            while (!pred())
+                std::this_thread::yield();
+        }
+
+        void notify() {}
+    };
+
+    /**
+     * @brief Producer of rpp::subjects::broadcast_subject sleeps on condition variable while ring buffer is full. Consumers wake it up after processing of emissions.
+     */
+    class blocking
+    {
+    public:
+        template<std::predicate Pred>
+        void wait_until(const Pred& pred)
+        {
+            std::unique_lock lock{m_mutex};
+            // read-modify-write pairs with the one in `notify`: either consumer sees waiter or producer sees progress of consumer
+            m_waiters.fetch_add(1, std::memory_order::acq_rel);
+            m_cv.wait(lock, pred);
+            m_waiters.fetch_sub(1, std::memory_order::relaxed);
+        }
+
+        void notify()
+        {
+            if (m_waiters.fetch_add(0, std::memory_order::acq_rel) == 0)
+                return;
+
+            std::lock_guard lock{m_mutex};
+            m_cv.notify_all();
+        }
+
+    private:
+        std::mutex              m_mutex{};
+        std::condition_variable m_cv{};
+        std::atomic<size_t>     m_waiters{};
+    };
+} // namespace rpp::subjects::wait_strategy
+
+namespace rpp::subjects::details
+{
+    template<rpp::constraint::decayed_type Type, rpp::schedulers::constraint::scheduler Scheduler, typename WaitStrategy>
+    class broadcast_state;
+
+    template<rpp::constraint::decayed_type Type, rpp::schedulers::constraint::scheduler Scheduler, typename WaitStrategy>
+    class broadcast_consumer;
+
+    template<rpp::constraint::decayed_type Type, rpp::schedulers::constraint::scheduler Scheduler, typename WaitStrategy>
+    struct broadcast_consumer_handler
+    {
+        std::shared_ptr<broadcast_consumer<Type, Scheduler, WaitStrategy>> consumer{};
+
+        bool is_disposed() const { return consumer->get_observer().is_disposed(); }
+
+        void on_error(const std::exception_ptr& err) const { consumer->get_observer().on_error(err); }
+    };
+
+    /**
+     * @brief Reader of ring buffer with its own cursor (sequence of next emission to read). Reads emissions in place via worker of its own and never copies them.
+     */
+    template<rpp::constraint::decayed_type Type, rpp::schedulers::constraint::scheduler Scheduler, typename WaitStrategy>
+    class broadcast_consumer final : public std::enable_shared_from_this<broadcast_consumer<Type, Scheduler, WaitStrategy>>
+    {
+        using state_t  = broadcast_state<Type, Scheduler, WaitStrategy>;
+        using worker_t = rpp::schedulers::utils::get_worker_t<Scheduler>;
+
+    public:
+        broadcast_consumer(std::weak_ptr<state_t> state, rpp::dynamic_observer<Type>&& observer, worker_t&& worker, uint64_t cursor)
+            : m_state{std::move(state)}
+            , m_observer{std::move(observer)}
+            , m_worker{std::move(worker)}
+            , m_cursor{cursor}
+        {
+        }
+
+        uint64_t get_cursor() const { return m_cursor.load(std::memory_order::acquire); }
+
+        const rpp::dynamic_observer<Type>& get_observer() const { return m_observer; }
+
+        void start()
+        {
+            auto d = rpp::composite_disposable_wrapper::make();
+            d.add(make_callback_disposable([weak = this->weak_from_this()]() noexcept {
+                if (const auto consumer = weak.lock())
+                    consumer->detach();
+            }));
+            if constexpr (!worker_t::is_none_disposable)
+            {
+                if (auto worker_disposable = m_worker.get_disposable(); !worker_disposable.is_disposed())
+                    d.add(std::move(worker_disposable));
+            }
+            m_observer.set_upstream(d);
+
+            // it is marked as scheduled during construction, so, producer can't schedule it concurrently
+            schedule_drain();
+        }
+
+        /**
+         * @brief Schedules drain if consumer is idle. Called by producer after publishing of emission or terminal event.
+         */
+        void wake()
+        {
+            if (!m_is_scheduled.load(std::memory_order::seq_cst) && !m_is_scheduled.exchange(true, std::memory_order::seq_cst))
+                schedule_drain();
+        }
+
+        void drain()
+        {
+            const auto state = m_state.lock();
+            if (!state)
+                return;
+
+            while (true)
+            {
+                const auto available = state->get_published();
+                auto       cursor    = m_cursor.load(std::memory_order::relaxed);
+                while (cursor < available && !m_observer.is_disposed())
+                {
+                    m_observer.on_next(state->get_slot(cursor));
+                    // releases slot for producer
+                    m_cursor.store(++cursor, std::memory_order::release);
+                }
+                state->notify_producer();
+
+                if (m_observer.is_disposed())
+                {
+                    detach();
+                    return;
+                }
+
+                if (state->is_terminated() && cursor == state->get_published())
+                {
+                    detach();
+                    state->forward_terminal_event(m_observer);
+                    return;
+                }
+
+                m_is_scheduled.store(false, std::memory_order::seq_cst);
+                // producer could publish something after last check, but see "scheduled" flag not reset yet
+                if (cursor == state->get_published() && !state->is_terminated())
+                    return;
+                if (m_is_scheduled.exchange(true, std::memory_order::seq_cst))
+                    return;
+            }
+        }
+
+        /**
+         * @brief Removes consumer from ring buffer: producer doesn't wait for it anymore.
+         */
+        void detach()
+        {
+            m_cursor.store(std::numeric_limits<uint64_t>::max(), std::memory_order::release);
+            if (const auto state = m_state.lock())
+            {
+                if (!m_is_detached.exchange(true, std::memory_order::relaxed))
+                    state->remove(this);
+                state->notify_producer();
+            }
+        }
+
+    private:
+        void schedule_drain()
+        {
+            using handler = broadcast_consumer_handler<Type, Scheduler, WaitStrategy>;
+            m_worker.schedule(
+                [](const handler& h) -> rpp::schedulers::optional_delay_from_now {
+                    h.consumer->drain();
+                    return std::nullopt;
+                },
+                handler{this->shared_from_this()});
+        }
+
+        std::weak_ptr<state_t>         m_state;
+        rpp::dynamic_observer<Type>    m_observer;
+        RPP_NO_UNIQUE_ADDRESS worker_t m_worker;
+
+        alignas(rpp::utils::cache_line_size) std::atomic<uint64_t> m_cursor;
+        std::atomic_bool                                           m_is_scheduled{true};
+        std::atomic_bool                                           m_is_detached{};
+    };
+
+    /**
+     * @brief Ring buffer of emissions of single producer shared among all consumers.
+     * @details Emission with sequence `N` is placed into slot `N % capacity` and published via `m_published`. Producer doesn't overwrite slot till all consumers moved their cursors past it: it waits via `WaitStrategy`.
+     */
+    template<rpp::constraint::decayed_type Type, rpp::schedulers::constraint::scheduler Scheduler, typename WaitStrategy>
+    class broadcast_state final : public composite_disposable
+        , public rpp::details::enable_wrapper_from_this<broadcast_state<Type, Scheduler, WaitStrategy>>
+    {
+        using consumer_t = broadcast_consumer<Type, Scheduler, WaitStrategy>;
+        using consumers  = std::shared_ptr<const std::vector<std::shared_ptr<consumer_t>>>;
+
+    public:
+        using expected_disposable_strategy = rpp::details::observables::atomic_fixed_disposable_strategy_selector<1>;
+
+        broadcast_state(size_t capacity, const Scheduler& scheduler)
+            : m_slots(std::bit_ceil(std::max(size_t{1}, capacity)))
+            , m_mask{m_slots.size() - 1}
+            , m_scheduler{scheduler}
+        {
+        }
+
+        template<typename TT>
+        void on_next(TT&& v)
+        {
+            if (is_disposed())
+                return;
+
+            const auto sequence = m_next;
+            // new consumer could subscribe since last emission: its cursor has to be taken into account before overwriting of slot
+            get_actual_consumers();
+            if (sequence - m_cached_min_cursor >= m_slots.size())
+                wait_for_free_slot(sequence);
+
+            m_slots[sequence & m_mask] = std::forward<TT>(v);
+            m_published.store(++m_next, std::memory_order::seq_cst);
+
+            for (const auto& consumer : get_actual_consumers())
+                consumer->wake();
+        }
+
+        void on_error(const std::exception_ptr& err)
+        {
+            terminate(err);
+            dispose();
+        }
+
+        void on_completed()
+        {
+            terminate(std::nullopt);
+            dispose();
+        }
+
+        template<rpp::constraint::observer_of_type<Type> TObs>
+        void on_subscribe(TObs&& observer)
+        {
+            std::unique_lock lock{m_mutex};
+            if (m_is_terminated.load(std::memory_order::relaxed))
+            {
+                lock.unlock();
+                if (!m_is_disposed_without_terminal)
+                    forward_terminal_event(observer);
+                return;
+            }
+
+            // version is bumped before cursor is taken: producer either sees new version before its next write (and re-reads consumers under lock) or didn't publish that write yet, so, cursor can't be behind its next write
+            m_version.fetch_add(1, std::memory_order::seq_cst);
+
+            // new consumer starts from the next emission
+            const auto consumer = std::make_shared<consumer_t>(this->wrapper_from_this().lock(), std::forward<TObs>(observer).as_dynamic(), m_scheduler.create_worker(), m_published.load(std::memory_order::seq_cst));
+
+            auto new_consumers = std::make_shared<std::vector<std::shared_ptr<consumer_t>>>(*m_consumers);
+            new_consumers->push_back(consumer);
+            m_consumers = std::move(new_consumers);
+            lock.unlock();
+
+            consumer->start();
+        }
+
+        uint64_t get_published() const { return m_published.load(std::memory_order::seq_cst); }
+
+        const Type& get_slot(uint64_t sequence) const { return m_slots[sequence & m_mask].value(); }
+
+        bool is_terminated() const { return m_is_terminated.load(std::memory_order::seq_cst); }
+
+        /**
+         * @warning Valid only after `is_terminated()` returned true
+         */
+        void forward_terminal_event(const rpp::constraint::observer auto& observer) const
+        {
+            if (m_is_disposed_without_terminal)
+                return;
+
+            if (m_error)
+                observer.on_error(m_error.value());
+            else
+                observer.on_completed();
+        }
+
+        void remove(const consumer_t* consumer)
+        {
+            {
+                std::lock_guard lock{m_mutex};
+                auto            new_consumers = std::make_shared<std::vector<std::shared_ptr<consumer_t>>>();
+                new_consumers->reserve(m_consumers->size());
+                std::copy_if(m_consumers->cbegin(), m_consumers->cend(), std::back_inserter(*new_consumers), [&](const auto& c) { return c.get() != consumer; });
+                m_consumers = std::move(new_consumers);
+                m_version.fetch_add(1, std::memory_order::seq_cst);
+            }
+            notify_producer();
+        }
+
+        void notify_producer() { m_wait_strategy.notify(); }
+
+    private:
+        void composite_dispose_impl(interface_disposable::Mode) noexcept override
+        {
+            // disposing without terminal event just drops all consumers
+            terminate(std::nullopt, true);
+        }
+
+        void terminate(std::optional<std::exception_ptr> err, bool is_disposed = false)
+        {
+            consumers to_wake{};
+            {
+                std::lock_guard lock{m_mutex};
+                if (m_is_terminated.load(std::memory_order::relaxed))
+                    return;
+
+                // published to consumers via store of `m_is_terminated`
+                m_error                        = std::move(err);
+                m_is_disposed_without_terminal = is_disposed;
+                m_is_terminated.store(true, std::memory_order::seq_cst);
+                to_wake = m_consumers;
+            }
+
+            for (const auto& consumer : *to_wake)
+                consumer->wake();
+        }
+
+        /**
+         * @brief Producer keeps its own snapshot of consumers and refreshes it only when list of consumers changed. Cached min cursor is recalculated with each refresh, so, it never misses newly subscribed consumer.
+         */
+        const std::vector<std::shared_ptr<consumer_t>>& get_actual_consumers()
+        {
+            if (m_version.load(std::memory_order::seq_cst) != m_producer_version)
+            {
+                {
+                    std::lock_guard lock{m_mutex};
+                    m_producer_consumers = m_consumers;
+                    m_producer_version   = m_version.load(std::memory_order::relaxed);
+                }
+
+                m_cached_min_cursor = m_next;
+                for (const auto& consumer : *m_producer_consumers)
+                    m_cached_min_cursor = std::min(m_cached_min_cursor, consumer->get_cursor());
+            }
+            return *m_producer_consumers;
+        }
+
+        void wait_for_free_slot(uint64_t sequence)
+        {
+            m_wait_strategy.wait_until([&] {
+                const auto& consumers = get_actual_consumers();
+                m_cached_min_cursor   = sequence;
+                for (const auto& consumer : consumers)
+                    m_cached_min_cursor = std::min(m_cached_min_cursor, consumer->get_cursor());
+                return sequence - m_cached_min_cursor < m_slots.size();
+            });
+        }
+
+        std::vector<std::optional<Type>> m_slots;
+        const uint64_t                   m_mask;
+        RPP_NO_UNIQUE_ADDRESS Scheduler  m_scheduler;
+        RPP_NO_UNIQUE_ADDRESS WaitStrategy m_wait_strategy{};
+
+        std::mutex                        m_mutex{};
+        consumers                         m_consumers = std::make_shared<std::vector<std::shared_ptr<consumer_t>>>();
+        std::optional<std::exception_ptr> m_error{};
+        bool                              m_is_disposed_without_terminal{};
+
+        // touched by producer only
+        alignas(rpp::utils::cache_line_size) uint64_t m_next{};
+        uint64_t                                      m_cached_min_cursor{};
+        uint64_t                                      m_producer_version{};
+        consumers                                     m_producer_consumers = m_consumers;
+
+        // touched by producer and consumers
+        alignas(rpp::utils::cache_line_size) std::atomic<uint64_t> m_published{};
+        std::atomic<uint64_t>                                      m_version{};
+        std::atomic_bool                                           m_is_terminated{};
+    };
+} // namespace rpp::subjects::details
+
+namespace rpp::subjects
+{
+    /**
+     * @brief Subject which multicasts emissions of single producer to observers processing them each on its own worker (thread) via one preallocated ring buffer.
+     *
+     * @details Each emission is written into ring buffer exactly once and all observers read it in place (observers obtain `const Type&` to slot of ring buffer) via their own cursors, so, there is no any per-observer queue and no per-observer copy of emission.
+     * @details Each observer is served by its own worker obtained via `scheduler.create_worker()`: emissions are emitted from this worker and producer never calls observers directly. Worker is scheduled only when observer transitions from idle to busy.
+     * @details Memory is bounded by `capacity` emissions (rounded up to power of two): when the slowest observer lags behind producer by `capacity` emissions, producer waits (via `WaitStrategy`) till this observer frees slot. Disposed observers are removed and don't hold producer anymore.
+     * @details Each observer obtains only emissions emitted after corresponding subscribe. on_error/on_completed are emitted after all emissions and cached for new observers.
+     *
+     * @par Performance notes:
+     * - No locks and no allocations on emission: 1 copy/move into slot + 1 atomic load (to detect new observers) + 1 atomic store, plus 1 atomic exchange per observer being idle
+     * - Mutex is acquired only when list of observers changed
+     *
+     * @warning This subject expects single producer: on_next/on_error/on_completed must be called serially.
+     * @warning Producer waits for the slowest observer when ring buffer is full, so, observers must not be served by the same thread as producer (for example, rpp::schedulers::run_loop dispatched by producer thread), otherwise full ring buffer is deadlock.
+     *
+     * @tparam Type value provided by this subject
+     * @tparam Scheduler is scheduler to obtain worker for each observer. Use scheduler with real concurrency (for example, rpp::schedulers::new_thread) to process observers in parallel
+     * @tparam WaitStrategy is the way producer waits for free slot in ring buffer: rpp::subjects::wait_strategy::busy_spin, rpp::subjects::wait_strategy::yielding or rpp::subjects::wait_strategy::blocking
+     *
+     * @ingroup subjects
+     * @see https://reactivex.io/documentation/subject.html
+     */
+    template<rpp::constraint::decayed_type Type, rpp::schedulers::constraint::scheduler Scheduler, typename WaitStrategy>
+    class broadcast_subject final
+    {
+        using state_t = details::broadcast_state<Type, Scheduler, WaitStrategy>;
+
+        struct observer_strategy
+        {
+            using preferred_disposable_strategy = rpp::details::observers::none_disposable_strategy;
+
+            std::shared_ptr<state_t> state{};
+
+            void set_upstream(const disposable_wrapper& d) const noexcept { state->add(d); }
+
+            bool is_disposed() const noexcept { return state->is_disposed(); }
+
+            void on_next(const Type& v) const { state->on_next(v); }
+
+            void on_next(Type&& v) const { state->on_next(std::move(v)); }
+
+            void on_error(const std::exception_ptr& err) const { state->on_error(err); }
+
+            void on_completed() const { state->on_completed(); }
+        };
+
+    public:
+        using expected_disposable_strategy = typename state_t::expected_disposable_strategy;
+
+        /**
+         * @param capacity is amount of emissions ring buffer can keep (rounded up to power of two)
+         * @param scheduler is scheduler to obtain worker for each observer
+         */
+        explicit broadcast_subject(size_t capacity, const Scheduler& scheduler = Scheduler{})
+            : m_state{disposable_wrapper_impl<state_t>::make(capacity, scheduler)}
+        {
+        }
+
+        auto get_observer() const
+        {
+            return rpp::observer<Type, observer_strategy>{m_state.lock()};
+        }
+
+        auto get_observable() const
+        {
+            return details::create_subject_on_subscribe_observable<Type, expected_disposable_strategy>([state = m_state]<rpp::constraint::observer_of_type<Type> TObs>(TObs&& observer) { state.lock()->on_subscribe(std::forward<TObs>(observer)); });
+        }
+
+        rpp::disposable_wrapper get_disposable() const
+        {
+            return m_state;
+        }
+
+    private:
+        disposable_wrapper_impl<state_t> m_state;
+    };
+} // namespace rpp::subjects
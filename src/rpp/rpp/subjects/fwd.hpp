@@ -12,6 +12,7 @@
 #include <rpp/disposables/fwd.hpp>
 #include <rpp/observables/fwd.hpp>
 #include <rpp/observers/fwd.hpp>
+#include <rpp/schedulers/fwd.hpp>
 
 #include <rpp/utils/constraints.hpp>
 #include <rpp/utils/utils.hpp>
@@ -32,6 +33,21 @@ namespace rpp::subjects
     class serialized_replay_subject;
 
 
+    namespace wait_strategy
+    {
+        struct yielding;
+    } // namespace wait_strategy
+
+    template<rpp::constraint::decayed_type Type, rpp::schedulers::constraint::scheduler Scheduler = rpp::schedulers::new_thread, typename WaitStrategy = wait_strategy::yielding>
+    class broadcast_subject;
+
+    template<rpp::constraint::decayed_type Type, rpp::schedulers::constraint::scheduler Scheduler = rpp::schedulers::new_thread>
+    class mailbox_subject;
+
+    template<rpp::constraint::hashable Key, rpp::constraint::decayed_type Type>
+    class keyed_subject;
+
+
 } // namespace rpp::subjects
 
 namespace rpp::constraint
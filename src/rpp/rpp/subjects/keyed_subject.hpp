@@ -0,0 +1,237 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/subjects/fwd.hpp>
+
+#include <rpp/disposables/callback_disposable.hpp>
+#include <rpp/disposables/composite_disposable.hpp>
+#include <rpp/disposables/disposable_wrapper.hpp>
+#include <rpp/observers/dynamic_observer.hpp>
+#include <rpp/observers/observer.hpp>
+#include <rpp/subjects/details/subject_on_subscribe.hpp>
+#include <rpp/subjects/details/subject_state.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace rpp::subjects::details
+{
+    /**
+     * @brief Index of observers by key. Observers of each key are kept in copy-on-write vector, so, emission is forwarded without holding lock.
+     * @details Observers of all keys ("wildcard" ones) and terminal events are handled via ordinary rpp::subjects::details::subject_state: it caches on_error/on_completed and forwards them to observers subscribed after termination.
+     */
+    template<rpp::constraint::hashable Key, rpp::constraint::decayed_type Type>
+    class keyed_subject_state final : public composite_disposable
+        , public rpp::details::enable_wrapper_from_this<keyed_subject_state<Key, Type>>
+    {
+        using shared_observers = std::shared_ptr<const std::vector<rpp::dynamic_observer<Type>>>;
+        using all_keys_state   = subject_state<Type, false>;
+
+    public:
+        using expected_disposable_strategy = rpp::details::observables::atomic_fixed_disposable_strategy_selector<1>;
+
+        keyed_subject_state() = default;
+
+        void on_next(const Key& key, const Type& v)
+        {
+            if (const auto observers = extract_observers(key))
+                rpp::utils::for_each(*observers, [&](const auto& sub) { sub.on_next(v); });
+
+            m_all_keys.lock()->on_next(v);
+        }
+
+        void on_error(const std::exception_ptr& err)
+        {
+            for (const auto& [_, observers] : exchange_observers())
+                rpp::utils::for_each(*observers, [&](const auto& sub) { sub.on_error(err); });
+
+            m_all_keys.lock()->on_error(err);
+            dispose();
+        }
+
+        void on_completed()
+        {
+            for (const auto& [_, observers] : exchange_observers())
+                rpp::utils::for_each(*observers, rpp::utils::static_mem_fn<&dynamic_observer<Type>::on_completed>{});
+
+            m_all_keys.lock()->on_completed();
+            dispose();
+        }
+
+        template<rpp::constraint::observer_of_type<Type> TObs>
+        void on_subscribe(TObs&& observer)
+        {
+            m_all_keys.lock()->on_subscribe(std::forward<TObs>(observer));
+        }
+
+        template<rpp::constraint::observer_of_type<Type> TObs>
+        void on_subscribe(const Key& key, TObs&& observer)
+        {
+            std::unique_lock lock{m_mutex};
+            if (m_is_terminated)
+            {
+                lock.unlock();
+                // forwards cached terminal event (if any)
+                m_all_keys.lock()->on_subscribe(std::forward<TObs>(observer));
+                return;
+            }
+
+            auto  observer_as_dynamic = std::forward<TObs>(observer).as_dynamic();
+            auto& observers           = m_observers[key];
+            auto  new_observers       = std::make_shared<std::vector<rpp::dynamic_observer<Type>>>();
+            new_observers->reserve((observers ? observers->size() : 0) + 1);
+            if (observers)
+                std::copy(observers->cbegin(), observers->cend(), std::back_inserter(*new_observers));
+            new_observers->push_back(observer_as_dynamic);
+            observers = std::move(new_observers);
+            lock.unlock();
+
+            observer_as_dynamic.set_upstream(rpp::disposable_wrapper{make_callback_disposable(
+                [weak = this->wrapper_from_this().as_weak(), key]() noexcept // NOLINT(bugprone-exception-escape)
+                {
+                    if (const auto shared = weak.lock())
+                        shared->remove_disposed_observers(key);
+                })});
+        }
+
+    private:
+        void composite_dispose_impl(interface_disposable::Mode) noexcept override
+        {
+            exchange_observers();
+            m_all_keys.dispose();
+        }
+
+        void remove_disposed_observers(const Key& key)
+        {
+            std::lock_guard lock{m_mutex};
+            const auto      itr = m_observers.find(key);
+            if (itr == m_observers.end())
+                return;
+
+            auto new_observers = std::make_shared<std::vector<rpp::dynamic_observer<Type>>>();
+            std::copy_if(itr->second->cbegin(),
+                         itr->second->cend(),
+                         std::back_inserter(*new_observers),
+                         rpp::utils::static_not_mem_fn<&dynamic_observer<Type>::is_disposed>{});
+
+            // key without observers is removed from index to keep it bounded by amount of actually observed keys
+            if (new_observers->empty())
+                m_observers.erase(itr);
+            else
+                itr->second = std::move(new_observers);
+        }
+
+        shared_observers extract_observers(const Key& key)
+        {
+            std::lock_guard lock{m_mutex};
+            if (const auto itr = m_observers.find(key); itr != m_observers.end())
+                return itr->second;
+            return {};
+        }
+
+        std::unordered_map<Key, shared_observers> exchange_observers()
+        {
+            std::lock_guard lock{m_mutex};
+            m_is_terminated = true;
+            return std::exchange(m_observers, {});
+        }
+
+    private:
+        disposable_wrapper_impl<all_keys_state>   m_all_keys = disposable_wrapper_impl<all_keys_state>::make();
+        std::mutex                                m_mutex{};
+        std::unordered_map<Key, shared_observers> m_observers{};
+        bool                                      m_is_terminated{};
+    };
+} // namespace rpp::subjects::details
+
+namespace rpp::subjects
+{
+    /**
+     * @brief Subject which routes emissions to observers by key: observer obtains only emissions with key it subscribed to, so, each emission is forwarded only to interested observers instead of evaluating filter in each observer.
+     *
+     * @details Observer of this subject expects `std::pair<Key, Type>`: key is used to find observers via hash index and value is forwarded to them.
+     * @details `get_observable(key)` provides observable of emissions with provided key, `get_observable()` provides observable of emissions of all keys ("wildcard" subscription).
+     * @details Like rpp::subjects::publish_subject each observer obtains only values which emitted after corresponding subscribe. on_error/on_completed/dispose are forwarded to observers of all keys and cached for new observers.
+     *
+     * @par Performance notes:
+     * - Cost of emission is one hash lookup under mutex plus observers of this key and wildcard observers. Observers of other keys are not touched at all
+     * - Subscription/unsubscription copies observers of its key only
+     *
+     * @warning this subject is not synchronized/serialized! It means, that expected to call callbacks of observer in the serialized way to follow observable contract.
+     *
+     * @tparam Key is type of key emissions routed by. Should be hashable.
+     * @tparam Type value provided by this subject
+     *
+     * @ingroup subjects
+     * @see https://reactivex.io/documentation/subject.html
+     */
+    template<rpp::constraint::hashable Key, rpp::constraint::decayed_type Type>
+    class keyed_subject final
+    {
+        using state_t = details::keyed_subject_state<Key, Type>;
+
+        struct observer_strategy
+        {
+            using preferred_disposable_strategy = rpp::details::observers::none_disposable_strategy;
+
+            std::shared_ptr<state_t> state{};
+
+            void set_upstream(const disposable_wrapper& d) const noexcept { state->add(d); }
+
+            bool is_disposed() const noexcept { return state->is_disposed(); }
+
+            void on_next(const std::pair<Key, Type>& v) const { state->on_next(v.first, v.second); }
+
+            void on_error(const std::exception_ptr& err) const { state->on_error(err); }
+
+            void on_completed() const { state->on_completed(); }
+        };
+
+    public:
+        using expected_disposable_strategy = typename state_t::expected_disposable_strategy;
+
+        keyed_subject() = default;
+
+        auto get_observer() const
+        {
+            return rpp::observer<std::pair<Key, Type>, observer_strategy>{m_state.lock()};
+        }
+
+        /**
+         * @brief Observable of emissions of all keys
+         */
+        auto get_observable() const
+        {
+            return details::create_subject_on_subscribe_observable<Type, expected_disposable_strategy>([state = m_state]<rpp::constraint::observer_of_type<Type> TObs>(TObs&& observer) { state.lock()->on_subscribe(std::forward<TObs>(observer)); });
+        }
+
+        /**
+         * @brief Observable of emissions with provided key only
+         */
+        auto get_observable(Key key) const
+        {
+            return details::create_subject_on_subscribe_observable<Type, expected_disposable_strategy>([state = m_state, key = std::move(key)]<rpp::constraint::observer_of_type<Type> TObs>(TObs&& observer) { state.lock()->on_subscribe(key, std::forward<TObs>(observer)); });
+        }
+
+        rpp::disposable_wrapper get_disposable() const
+        {
+            return m_state;
+        }
+
+    private:
+        disposable_wrapper_impl<state_t> m_state = disposable_wrapper_impl<state_t>::make();
+    };
+} // namespace rpp::subjects
@@ -0,0 +1,390 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/subjects/fwd.hpp>
+
+#include <rpp/disposables/composite_disposable.hpp>
+#include <rpp/disposables/disposable_wrapper.hpp>
+#include <rpp/observers/dynamic_observer.hpp>
+#include <rpp/observers/observer.hpp>
+#include <rpp/schedulers/new_thread.hpp>
+#include <rpp/subjects/details/subject_on_subscribe.hpp>
+#include <rpp/subjects/details/subject_state.hpp>
+#include <rpp/utils/exceptions.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+namespace rpp::subjects
+{
+    /**
+     * @brief What rpp::subjects::mailbox_subject does with new emission when mailbox of observer is full
+     */
+    enum class overflow_policy
+    {
+        drop_oldest, ///< oldest emission in mailbox is dropped to free space for new one
+        drop_newest, ///< new emission is dropped
+        disconnect   ///< mailbox is cleared and observer obtains on_error with rpp::utils::mailbox_overflow
+    };
+
+    /**
+     * @brief Counters of mailboxes of rpp::subjects::mailbox_subject. Can be read at any time from any thread.
+     */
+    struct mailbox_stats
+    {
+        /**
+         * @brief Amount of emissions placed into mailbox
+         */
+        std::atomic<size_t> enqueued{};
+        /**
+         * @brief Amount of emissions emitted to observer
+         */
+        std::atomic<size_t> delivered{};
+        /**
+         * @brief Amount of emissions dropped due to overflow
+         */
+        std::atomic<size_t> dropped{};
+        /**
+         * @brief Amount of emissions waiting in mailbox right now
+         */
+        std::atomic<size_t> lag{};
+        /**
+         * @brief Maximal amount of emissions ever waited in mailbox
+         */
+        std::atomic<size_t> max_lag{};
+        /**
+         * @brief Amount of observers disconnected due to overflow
+         */
+        std::atomic<size_t> disconnected{};
+    };
+
+    /**
+     * @brief Parameters of mailbox of observer of rpp::subjects::mailbox_subject
+     */
+    struct mailbox_options
+    {
+        size_t                         capacity = 1024;
+        overflow_policy                policy   = overflow_policy::drop_oldest;
+        /**
+         * @brief Optional counters to be updated by mailbox. Can be shared among multiple observers to obtain aggregated values.
+         */
+        std::shared_ptr<mailbox_stats> stats{};
+    };
+} // namespace rpp::subjects
+
+namespace rpp::subjects::details
+{
+    template<rpp::constraint::decayed_type Type, rpp::schedulers::constraint::scheduler Scheduler>
+    class mailbox;
+
+    template<rpp::constraint::decayed_type Type, rpp::schedulers::constraint::scheduler Scheduler>
+    struct mailbox_handler
+    {
+        std::shared_ptr<mailbox<Type, Scheduler>> state{};
+
+        bool is_disposed() const { return state->is_disposed(); }
+
+        void on_error(const std::exception_ptr& err) const { state->get_observer().on_error(err); }
+    };
+
+    /**
+     * @brief Bounded queue of emissions of single observer drained via worker of its own. Producer only places emissions into queue and never calls observer directly.
+     */
+    template<rpp::constraint::decayed_type Type, rpp::schedulers::constraint::scheduler Scheduler>
+    class mailbox final : public std::enable_shared_from_this<mailbox<Type, Scheduler>>
+    {
+        using worker_t = rpp::schedulers::utils::get_worker_t<Scheduler>;
+
+    public:
+        mailbox(rpp::dynamic_observer<Type>&& observer, worker_t&& worker, const mailbox_options& options)
+            : m_observer{std::move(observer)}
+            , m_worker{std::move(worker)}
+            , m_capacity{std::max(size_t{1}, options.capacity)}
+            , m_policy{options.policy}
+            , m_stats{options.stats}
+        {
+            if constexpr (!worker_t::is_none_disposable)
+            {
+                if (auto d = m_worker.get_disposable(); !d.is_disposed())
+                    m_disposable.add(std::move(d));
+            }
+            m_observer.set_upstream(m_disposable);
+        }
+
+        const rpp::dynamic_observer<Type>& get_observer() const { return m_observer; }
+
+        void add_upstream(const rpp::disposable_wrapper& d) { m_disposable.add(d); }
+
+        bool is_disposed() const { return m_disposable.is_disposed(); }
+
+        void on_next(const Type& v)
+        {
+            {
+                std::lock_guard lock{m_mutex};
+                if (m_is_terminated)
+                    return;
+
+                if (m_queue.size() >= m_capacity)
+                {
+                    increment(&mailbox_stats::dropped);
+                    switch (m_policy)
+                    {
+                    case overflow_policy::drop_newest:
+                        return;
+                    case overflow_policy::drop_oldest:
+                        m_queue.pop_front();
+                        decrement_lag();
+                        break;
+                    case overflow_policy::disconnect:
+                        add(&mailbox_stats::dropped, m_queue.size());
+                        subtract_lag(m_queue.size());
+                        m_queue.clear();
+                        increment(&mailbox_stats::disconnected);
+                        m_error         = std::make_exception_ptr(rpp::utils::mailbox_overflow{"Mailbox of observer is overflowed"});
+                        m_is_terminated = true;
+                        break;
+                    }
+                }
+
+                if (!m_is_terminated)
+                {
+                    m_queue.push_back(v);
+                    increment(&mailbox_stats::enqueued);
+                    increment_lag();
+                }
+
+                if (std::exchange(m_is_scheduled, true))
+                    return;
+            }
+            schedule_drain();
+        }
+
+        void on_error(const std::exception_ptr& err)
+        {
+            terminate(err);
+        }
+
+        void on_completed()
+        {
+            terminate(std::nullopt);
+        }
+
+        void drain()
+        {
+            while (!is_disposed())
+            {
+                std::unique_lock lock{m_mutex};
+                if (m_queue.empty())
+                {
+                    if (!m_is_terminated)
+                    {
+                        m_is_scheduled = false;
+                        return;
+                    }
+                    const auto err = m_error;
+                    lock.unlock();
+
+                    if (err)
+                        m_observer.on_error(err.value());
+                    else
+                        m_observer.on_completed();
+                    return;
+                }
+
+                auto v = std::move(m_queue.front());
+                m_queue.pop_front();
+                decrement_lag();
+                lock.unlock();
+
+                m_observer.on_next(std::move(v));
+                increment(&mailbox_stats::delivered);
+            }
+        }
+
+    private:
+        void terminate(std::optional<std::exception_ptr> err)
+        {
+            {
+                std::lock_guard lock{m_mutex};
+                if (std::exchange(m_is_terminated, true))
+                    return;
+
+                m_error = std::move(err);
+                if (std::exchange(m_is_scheduled, true))
+                    return;
+            }
+            schedule_drain();
+        }
+
+        void schedule_drain()
+        {
+            m_worker.schedule(
+                [](const mailbox_handler<Type, Scheduler>& handler) -> rpp::schedulers::optional_delay_from_now {
+                    handler.state->drain();
+                    return std::nullopt;
+                },
+                mailbox_handler<Type, Scheduler>{this->shared_from_this()});
+        }
+
+        void increment(std::atomic<size_t> mailbox_stats::*counter) const { add(counter, 1); }
+
+        void add(std::atomic<size_t> mailbox_stats::*counter, size_t count) const
+        {
+            if (m_stats)
+                ((*m_stats).*counter).fetch_add(count, std::memory_order::relaxed);
+        }
+
+        void increment_lag() const
+        {
+            if (!m_stats)
+                return;
+
+            const auto lag     = m_stats->lag.fetch_add(1, std::memory_order::relaxed) + 1;
+            auto       max_lag = m_stats->max_lag.load(std::memory_order::relaxed);
+            while (max_lag < lag && !m_stats->max_lag.compare_exchange_weak(max_lag, lag, std::memory_order::relaxed))
+            {
+            }
+        }
+
+        void decrement_lag() const { subtract_lag(1); }
+
+        void subtract_lag(size_t count) const
+        {
+            if (m_stats)
+                m_stats->lag.fetch_sub(count, std::memory_order::relaxed);
+        }
+
+        rpp::dynamic_observer<Type>       m_observer;
+        RPP_NO_UNIQUE_ADDRESS worker_t    m_worker;
+        rpp::composite_disposable_wrapper m_disposable = rpp::composite_disposable_wrapper::make();
+        const size_t                      m_capacity;
+        const overflow_policy             m_policy;
+        std::shared_ptr<mailbox_stats>    m_stats;
+
+        std::mutex                        m_mutex{};
+        std::deque<Type>                  m_queue{};
+        std::optional<std::exception_ptr> m_error{};
+        bool                              m_is_terminated{};
+        bool                              m_is_scheduled{};
+    };
+
+    template<rpp::constraint::decayed_type Type, rpp::schedulers::constraint::scheduler Scheduler>
+    struct mailbox_observer_strategy
+    {
+        using preferred_disposable_strategy = rpp::details::observers::none_disposable_strategy;
+
+        std::shared_ptr<mailbox<Type, Scheduler>> state{};
+
+        void set_upstream(const disposable_wrapper& d) const { state->add_upstream(d); }
+
+        bool is_disposed() const { return state->is_disposed(); }
+
+        void on_next(const Type& v) const { state->on_next(v); }
+
+        void on_error(const std::exception_ptr& err) const { state->on_error(err); }
+
+        void on_completed() const { state->on_completed(); }
+    };
+} // namespace rpp::subjects::details
+
+namespace rpp::subjects
+{
+    /**
+     * @brief Subject which multicasts values to observers like rpp::subjects::publish_subject, but each observer obtains them via its own bounded mailbox drained on worker of its own, so, slow observer never blocks producer and other observers.
+     *
+     * @details Producer just copies emission into mailbox of each observer and schedules draining of mailbox if it was idle. Each mailbox is drained via worker obtained via `scheduler.create_worker()`, so, observers are never called from producer's thread (except of case when scheduler itself is immediate one).
+     * @details Mailbox keeps at most `capacity` emissions. When mailbox is full, new emission is handled according to rpp::subjects::overflow_policy of this mailbox: oldest or newest emission is dropped, or observer is disconnected (all its pending emissions are dropped and it obtains on_error with rpp::utils::mailbox_overflow).
+     * @details Each observer can have its own rpp::subjects::mailbox_options passed to `get_observable(options)` - observable obtained via `get_observable()` uses options passed to constructor. Lag of observers (and amount of dropped emissions) can be tracked via rpp::subjects::mailbox_stats passed to options.
+     * @details Each observer obtains only values which emitted after corresponding subscribe. on_error/on_completed are delivered after all pending emissions and cached for new observers.
+     *
+     * @par Performance notes:
+     * - 1 heap allocation per observer (mailbox) and 1 copy of each emission per observer
+     * - Mutex of mailbox is acquired by producer and by worker of observer for each emission, but observer is never called under lock
+     * - Worker is scheduled only when mailbox transitions from idle to busy
+     *
+     * @tparam Type value provided by this subject
+     * @tparam Scheduler is scheduler to obtain worker for each observer
+     *
+     * @ingroup subjects
+     * @see https://reactivex.io/documentation/subject.html
+     */
+    template<rpp::constraint::decayed_type Type, rpp::schedulers::constraint::scheduler Scheduler>
+    class mailbox_subject final
+    {
+        using state_t = details::subject_state<Type, false>;
+
+        struct observer_strategy
+        {
+            using preferred_disposable_strategy = rpp::details::observers::none_disposable_strategy;
+
+            std::shared_ptr<state_t> state{};
+
+            void set_upstream(const disposable_wrapper& d) const noexcept { state->add(d); }
+
+            bool is_disposed() const noexcept { return state->is_disposed(); }
+
+            void on_next(const Type& v) const { state->on_next(v); }
+
+            void on_error(const std::exception_ptr& err) const { state->on_error(err); }
+
+            void on_completed() const { state->on_completed(); }
+        };
+
+    public:
+        using expected_disposable_strategy = rpp::details::observables::deduce_disposable_strategy_t<state_t>;
+
+        /**
+         * @param scheduler is scheduler to obtain worker for each observer
+         * @param options are options of mailboxes of observers subscribed via `get_observable()`
+         */
+        explicit mailbox_subject(const Scheduler& scheduler = Scheduler{}, mailbox_options options = {})
+            : m_scheduler{scheduler}
+            , m_options{std::move(options)}
+        {
+        }
+
+        auto get_observer() const
+        {
+            return rpp::observer<Type, observer_strategy>{m_state.lock()};
+        }
+
+        auto get_observable() const
+        {
+            return get_observable(m_options);
+        }
+
+        /**
+         * @brief Observable whose observers obtain mailboxes with provided options
+         */
+        auto get_observable(mailbox_options options) const
+        {
+            return details::create_subject_on_subscribe_observable<Type, expected_disposable_strategy>([state = m_state, scheduler = m_scheduler, options = std::move(options)]<rpp::constraint::observer_of_type<Type> TObs>(TObs&& observer) {
+                auto mailbox = std::make_shared<details::mailbox<Type, Scheduler>>(std::forward<TObs>(observer).as_dynamic(), scheduler.create_worker(), options);
+                state.lock()->on_subscribe(rpp::observer<Type, details::mailbox_observer_strategy<Type, Scheduler>>{std::move(mailbox)});
+            });
+        }
+
+        rpp::disposable_wrapper get_disposable() const
+        {
+            return m_state;
+        }
+
+    private:
+        disposable_wrapper_impl<state_t> m_state = disposable_wrapper_impl<state_t>::make();
+        RPP_NO_UNIQUE_ADDRESS Scheduler  m_scheduler;
+        mailbox_options                  m_options;
+    };
+} // namespace rpp::subjects
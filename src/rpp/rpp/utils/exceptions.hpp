@@ -23,4 +23,14 @@ namespace rpp::utils
     {
         using std::runtime_error::runtime_error;
     };
+
+    struct already_subscribed : public std::runtime_error
+    {
+        using std::runtime_error::runtime_error;
+    };
+
+    struct mailbox_overflow : public std::runtime_error
+    {
+        using std::runtime_error::runtime_error;
+    };
 } // namespace rpp::utils
\ No newline at end of file
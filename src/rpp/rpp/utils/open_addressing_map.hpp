@@ -0,0 +1,198 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/utils/constraints.hpp>
+
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace rpp::utils
+{
+    /**
+     * @brief Minimal hash map with open addressing (linear probing) keeping keys and values inline in single flat array.
+     * @details Used by operators keeping small per-key state: there is no heap allocation per key and no node overhead. Erasing uses backward shift, so, there are no tombstones and lookups stay short after evictions.
+     * @warning Any insertion can invalidate pointers to values
+     */
+    template<rpp::constraint::hashable Key, typename Value, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+    class open_addressing_map
+    {
+        struct slot
+        {
+            Key   key;
+            Value value;
+        };
+
+    public:
+        size_t size() const { return m_size; }
+
+        bool empty() const { return m_size == 0; }
+
+        Value* find(const Key& key)
+        {
+            if (const auto index = find_index(key))
+                return &m_slots[index.value()]->value;
+            return nullptr;
+        }
+
+        const Value* find(const Key& key) const
+        {
+            if (const auto index = find_index(key))
+                return &m_slots[index.value()]->value;
+            return nullptr;
+        }
+
+        /**
+         * @brief Constructs value from args if there is no such a key
+         * @return pointer to value with such a key and flag if value was inserted
+         */
+        template<typename... Args>
+        std::pair<Value*, bool> try_emplace(const Key& key, Args&&... args)
+        {
+            if (auto* value = find(key))
+                return {value, false};
+
+            grow_if_needed();
+
+            size_t index = home_index(key);
+            while (m_slots[index])
+                index = next(index);
+
+            m_slots[index].emplace(slot{key, Value(std::forward<Args>(args)...)});
+            ++m_size;
+            return {&m_slots[index]->value, true};
+        }
+
+        bool erase(const Key& key)
+        {
+            if (const auto index = find_index(key))
+            {
+                erase_at(index.value());
+                return true;
+            }
+            return false;
+        }
+
+        /**
+         * @brief Erases all entries satisfying `pred(const Key&, Value&)`
+         * @warning Predicate can be invoked more than once for same entry
+         */
+        template<typename Pred>
+        size_t erase_if(Pred&& pred)
+        {
+            size_t erased{};
+            for (size_t i = 0; i < m_slots.size(); ++i)
+            {
+                // backward shift can move next entry into erased slot, so, check same slot again
+                while (m_slots[i] && pred(std::as_const(m_slots[i]->key), m_slots[i]->value))
+                {
+                    erase_at(i);
+                    ++erased;
+                }
+            }
+            return erased;
+        }
+
+        /**
+         * @brief Invokes `fn(const Key&, Value&)` for each entry in unspecified order
+         */
+        template<typename Fn>
+        void for_each(Fn&& fn)
+        {
+            for (auto& s : m_slots)
+            {
+                if (s)
+                    fn(std::as_const(s->key), s->value);
+            }
+        }
+
+        /**
+         * @brief Removes all entries but keeps allocated slots, so, map can be refilled without allocations
+         */
+        void clear()
+        {
+            for (auto& s : m_slots)
+                s.reset();
+            m_size = 0;
+        }
+
+    private:
+        static constexpr size_t s_bits = 64;
+
+        size_t home_index(const Key& key) const
+        {
+            // fibonacci hashing to spread poor hashes (like identity one for integers) over whole table
+            return static_cast<size_t>((static_cast<uint64_t>(Hash{}(key)) * 0x9E3779B97F4A7C15ull) >> m_shift);
+        }
+
+        size_t next(size_t index) const { return (index + 1) & (m_slots.size() - 1); }
+
+        std::optional<size_t> find_index(const Key& key) const
+        {
+            if (m_slots.empty())
+                return std::nullopt;
+
+            for (size_t index = home_index(key); m_slots[index]; index = next(index))
+            {
+                if (KeyEqual{}(m_slots[index]->key, key))
+                    return index;
+            }
+            return std::nullopt;
+        }
+
+        void erase_at(size_t hole)
+        {
+            m_slots[hole].reset();
+            --m_size;
+
+            for (size_t index = next(hole); m_slots[index]; index = next(index))
+            {
+                // entry can't be moved before its home slot
+                const size_t home = home_index(m_slots[index]->key);
+                if (hole <= index ? (hole < home && home <= index) : (hole < home || home <= index))
+                    continue;
+
+                m_slots[hole] = std::move(m_slots[index]);
+                m_slots[index].reset();
+                hole = index;
+            }
+        }
+
+        void grow_if_needed()
+        {
+            // keep load factor <= 0.75
+            if ((m_size + 1) * 4 <= m_slots.size() * 3)
+                return;
+
+            auto old_slots = std::exchange(m_slots, std::vector<std::optional<slot>>(m_slots.empty() ? 8 : m_slots.size() * 2));
+            m_shift        = s_bits - static_cast<size_t>(std::countr_zero(m_slots.size()));
+            for (auto& s : old_slots)
+            {
+                if (!s)
+                    continue;
+
+                size_t index = home_index(s->key);
+                while (m_slots[index])
+                    index = next(index);
+                m_slots[index] = std::move(s);
+            }
+        }
+
+    private:
+        std::vector<std::optional<slot>> m_slots{};
+        size_t                           m_size{};
+        size_t                           m_shift{s_bits};
+    };
+} // namespace rpp::utils
@@ -0,0 +1,309 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/utils/constraints.hpp>
+#include <rpp/utils/open_addressing_map.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace rpp::utils
+{
+    namespace details
+    {
+        /**
+         * @brief Finalizer of splitmix64 to obtain well distributed bits from any std::hash (identity one for integers too)
+         */
+        constexpr uint64_t mix_hash(uint64_t h)
+        {
+            h ^= h >> 30;
+            h *= 0xBF58476D1CE4E5B9ull;
+            h ^= h >> 27;
+            h *= 0x94D049BB133111EBull;
+            h ^= h >> 31;
+            return h;
+        }
+    } // namespace details
+
+    /**
+     * @brief HyperLogLog sketch estimating amount of distinct values with `2^precision` bytes of memory and ~`1.04/sqrt(2^precision)` relative error.
+     * @details Registers are kept as flat array of bytes, so, merging and estimation are simple loops over contiguous memory which compilers vectorize.
+     */
+    template<rpp::constraint::hashable T, typename Hash = std::hash<T>>
+    class hyperloglog
+    {
+    public:
+        static constexpr size_t min_precision = 4;
+        static constexpr size_t max_precision = 18;
+
+        explicit hyperloglog(size_t precision)
+            : m_precision{std::clamp(precision, min_precision, max_precision)}
+            , m_registers(size_t{1} << m_precision)
+        {
+        }
+
+        void add(const T& v)
+        {
+            const uint64_t hash  = details::mix_hash(static_cast<uint64_t>(Hash{}(v)));
+            const size_t   index = static_cast<size_t>(hash >> (64 - m_precision));
+            // guard bit limits rank in case of all remaining bits are zero
+            const uint64_t rest = (hash << m_precision) | (uint64_t{1} << (m_precision - 1));
+            const auto     rank = static_cast<uint8_t>(std::countl_zero(rest) + 1);
+            m_registers[index]  = std::max(m_registers[index], rank);
+        }
+
+        void merge(const hyperloglog& other)
+        {
+            for (size_t i = 0; i < m_registers.size(); ++i)
+                m_registers[i] = std::max(m_registers[i], other.m_registers[i]);
+        }
+
+        size_t estimate() const
+        {
+            static constexpr auto inverse_powers = [] {
+                std::array<double, 66> res{};
+                double                 v = 1.0;
+                for (auto& r : res)
+                {
+                    r = v;
+                    v /= 2;
+                }
+                return res;
+            }();
+
+            double sum{};
+            size_t zeros{};
+            for (const auto r : m_registers)
+            {
+                sum += inverse_powers[r];
+                zeros += (r == 0);
+            }
+
+            const auto m        = static_cast<double>(m_registers.size());
+            const auto estimate = alpha(m_registers.size()) * m * m / sum;
+            // linear counting is more precise for small cardinalities
+            if (estimate <= 2.5 * m && zeros != 0)
+                return static_cast<size_t>(std::llround(m * std::log(m / static_cast<double>(zeros))));
+            return static_cast<size_t>(std::llround(estimate));
+        }
+
+    private:
+        static double alpha(size_t m)
+        {
+            switch (m)
+            {
+                case 16: return 0.673;
+                case 32: return 0.697;
+                case 64: return 0.709;
+                default: return 0.7213 / (1.0 + 1.079 / static_cast<double>(m));
+            }
+        }
+
+        size_t               m_precision;
+        std::vector<uint8_t> m_registers;
+    };
+
+    /**
+     * @brief Space-Saving sketch keeping `capacity` counters to find the most frequent values. Count of any value is overestimated not more than `total / capacity`.
+     * @details Counters are kept in indexed min-heap, so, replacing of the least frequent counter is O(log capacity) and there is no allocations after warm-up.
+     */
+    template<rpp::constraint::hashable T, typename Hash = std::hash<T>>
+    class space_saving
+    {
+        struct counter
+        {
+            T      value;
+            size_t count;
+        };
+
+    public:
+        explicit space_saving(size_t capacity)
+            : m_capacity{std::max(capacity, size_t{1})}
+        {
+        }
+
+        void add(const T& v)
+        {
+            if (auto* position = m_positions.find(v))
+            {
+                ++m_heap[*position].count;
+                sift_down(*position);
+                return;
+            }
+
+            if (m_heap.size() < m_capacity)
+            {
+                m_heap.push_back(counter{v, 1});
+                m_positions.try_emplace(v, m_heap.size() - 1);
+                sift_up(m_heap.size() - 1);
+                return;
+            }
+
+            // new value inherits count of evicted one as possible overestimation
+            m_positions.erase(m_heap.front().value);
+            m_heap.front().value = v;
+            ++m_heap.front().count;
+            m_positions.try_emplace(v, 0);
+            sift_down(0);
+        }
+
+        /**
+         * @return up to `k` most frequent values with their estimated counts in descending order of count
+         */
+        std::vector<std::pair<T, size_t>> top(size_t k) const
+        {
+            std::vector<std::pair<T, size_t>> res{};
+            res.reserve(m_heap.size());
+            for (const auto& c : m_heap)
+                res.emplace_back(c.value, c.count);
+
+            k = std::min(k, res.size());
+            std::partial_sort(res.begin(), res.begin() + static_cast<std::ptrdiff_t>(k), res.end(), [](const auto& l, const auto& r) { return l.second > r.second; });
+            res.resize(k);
+            return res;
+        }
+
+    private:
+        void swap_counters(size_t l, size_t r)
+        {
+            std::swap(m_heap[l], m_heap[r]);
+            *m_positions.find(m_heap[l].value) = l;
+            *m_positions.find(m_heap[r].value) = r;
+        }
+
+        void sift_up(size_t i)
+        {
+            while (i != 0)
+            {
+                const size_t parent = (i - 1) / 2;
+                if (m_heap[parent].count <= m_heap[i].count)
+                    return;
+                swap_counters(i, parent);
+                i = parent;
+            }
+        }
+
+        void sift_down(size_t i)
+        {
+            while (true)
+            {
+                size_t       smallest = i;
+                const size_t left     = 2 * i + 1;
+                const size_t right    = left + 1;
+                if (left < m_heap.size() && m_heap[left].count < m_heap[smallest].count)
+                    smallest = left;
+                if (right < m_heap.size() && m_heap[right].count < m_heap[smallest].count)
+                    smallest = right;
+                if (smallest == i)
+                    return;
+                swap_counters(i, smallest);
+                i = smallest;
+            }
+        }
+
+        size_t                               m_capacity;
+        std::vector<counter>                 m_heap{};
+        open_addressing_map<T, size_t, Hash> m_positions{};
+    };
+
+    /**
+     * @brief KLL-like quantile sketch: hierarchy of compactors of `k` values each. Full compactor is sorted and every other value (with random offset) is promoted to next level with doubled weight.
+     * @details Memory is O(k * log(n/k)), rank error is O(log(n/k) / k).
+     */
+    template<typename T, typename Compare = std::less<T>>
+    class quantile_sketch
+    {
+    public:
+        explicit quantile_sketch(size_t k)
+            : m_k{std::max<size_t>(k + k % 2, 2)}
+        {
+        }
+
+        void add(const T& v)
+        {
+            if (m_levels.empty())
+                m_levels.emplace_back().reserve(m_k);
+
+            m_levels.front().push_back(v);
+            for (size_t level = 0; level < m_levels.size() && m_levels[level].size() >= m_k; ++level)
+                compact(level);
+        }
+
+        bool empty() const { return m_levels.empty(); }
+
+        /**
+         * @return values at provided normalized ranks (in range [0;1]) in the same order as ranks
+         */
+        std::vector<T> quantiles(const std::vector<double>& ranks) const
+        {
+            std::vector<std::pair<T, uint64_t>> weighted{};
+            uint64_t                            total{};
+            for (size_t level = 0; level < m_levels.size(); ++level)
+            {
+                for (const auto& v : m_levels[level])
+                    weighted.emplace_back(v, uint64_t{1} << level);
+                total += m_levels[level].size() << level;
+            }
+
+            std::vector<T> res{};
+            if (weighted.empty())
+                return res;
+
+            std::sort(weighted.begin(), weighted.end(), [](const auto& l, const auto& r) { return Compare{}(l.first, r.first); });
+
+            res.reserve(ranks.size());
+            for (const double rank : ranks)
+            {
+                const auto target     = static_cast<uint64_t>(std::ceil(std::clamp(rank, 0.0, 1.0) * static_cast<double>(total)));
+                uint64_t   cumulative = 0;
+                auto       itr        = weighted.cbegin();
+                for (; itr != std::prev(weighted.cend()); ++itr)
+                {
+                    cumulative += itr->second;
+                    if (cumulative >= target)
+                        break;
+                }
+                res.push_back(itr->first);
+            }
+            return res;
+        }
+
+    private:
+        void compact(size_t level)
+        {
+            if (level + 1 == m_levels.size())
+                m_levels.emplace_back().reserve(m_k);
+
+            auto& current = m_levels[level];
+            std::sort(current.begin(), current.end(), Compare{});
+
+            // xorshift is enough to avoid systematic bias of always dropping same half
+            m_random ^= m_random << 13;
+            m_random ^= m_random >> 7;
+            m_random ^= m_random << 17;
+
+            for (size_t i = m_random & 1; i < current.size(); i += 2)
+                m_levels[level + 1].push_back(std::move(current[i]));
+            current.clear();
+        }
+
+        size_t                      m_k;
+        std::vector<std::vector<T>> m_levels{};
+        uint64_t                    m_random{0x2545F4914F6CDD1Dull};
+    };
+} // namespace rpp::utils
@@ -0,0 +1,103 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/utils/constraints.hpp>
+#include <rpp/utils/utils.hpp>
+
+#include <array>
+#include <atomic>
+#include <optional>
+#include <utility>
+
+namespace rpp::utils
+{
+    /**
+     * @brief Unbounded lock-free queue for exactly one producer thread and exactly one consumer thread.
+     * @details Values are kept in linked chunks of `ChunkSize` slots. Producer publishes slot via release-store of amount of written slots of chunk, consumer observes it via acquire-load, so, there is neither lock nor CAS loop. Chunks are allocated by producer and freed by consumer once fully consumed.
+     * @warning `push` must not be called concurrently with another `push`, `pop` must not be called concurrently with another `pop`.
+     */
+    template<rpp::constraint::decayed_type T, size_t ChunkSize = 256>
+    class spsc_queue
+    {
+        static_assert(ChunkSize > 0);
+
+        struct chunk
+        {
+            std::array<std::optional<T>, ChunkSize> slots{};
+            std::atomic<size_t>                     written{};
+            std::atomic<chunk*>                     next{};
+        };
+
+    public:
+        spsc_queue()
+            : m_consumer{new chunk{}}
+            , m_producer{m_consumer.current}
+        {
+        }
+
+        spsc_queue(const spsc_queue&) = delete;
+        spsc_queue(spsc_queue&&)      = delete;
+
+        ~spsc_queue() noexcept
+        {
+            while (m_consumer.current)
+                delete std::exchange(m_consumer.current, m_consumer.current->next.load(std::memory_order::relaxed));
+        }
+
+        template<typename TT>
+        void push(TT&& v)
+        {
+            if (m_producer.index == ChunkSize)
+            {
+                auto* next = new chunk{};
+                m_producer.current->next.store(next, std::memory_order::release);
+                m_producer.current = next;
+                m_producer.index   = 0;
+            }
+
+            m_producer.current->slots[m_producer.index].emplace(std::forward<TT>(v));
+            m_producer.current->written.store(++m_producer.index, std::memory_order::release);
+        }
+
+        std::optional<T> pop()
+        {
+            if (m_consumer.index == ChunkSize)
+            {
+                auto* next = m_consumer.current->next.load(std::memory_order::acquire);
+                if (!next)
+                    return std::nullopt;
+
+                delete std::exchange(m_consumer.current, next);
+                m_consumer.index = 0;
+            }
+
+            if (m_consumer.index == m_consumer.current->written.load(std::memory_order::acquire))
+                return std::nullopt;
+
+            auto& slot   = m_consumer.current->slots[m_consumer.index++];
+            auto  result = std::move(slot);
+            slot.reset();
+            return result;
+        }
+
+    private:
+        // each side is touched only by its own thread, so, keep them in different cache lines
+        struct alignas(cache_line_size) side
+        {
+            chunk* current;
+            size_t index{};
+        };
+
+        side m_consumer;
+        side m_producer;
+    };
+} // namespace rpp::utils
@@ -253,6 +253,22 @@ namespace rpp::utils
         static constexpr void try_lock() {}
     };
 
+    /**
+     * @brief Assumed size of cache line. Used to keep data modified by different threads apart to prevent false sharing.
+     */
+    inline constexpr size_t cache_line_size = 64;
+
+    /**
+     * @brief Default layout of states shared among threads (see RPP_PAD_SHARED_STATES)
+     */
+    inline constexpr bool pad_shared_states = RPP_PAD_SHARED_STATES != 0;
+
+    /**
+     * @brief Alignment of field of state shared among threads. If `Padded`, field starts new cache line, so, fields written by different threads don't share cache line (no false sharing). Otherwise it is just natural alignment of `T`.
+     */
+    template<typename T, bool Padded = pad_shared_states>
+    inline constexpr size_t cache_line_alignment_v = Padded ? std::max(cache_line_size, alignof(T)) : alignof(T);
+
 #define RPP_CALL_DURING_CONSTRUCTION(...) RPP_NO_UNIQUE_ADDRESS rpp::utils::none _ = [&]() { \
     __VA_ARGS__;                                                                             \
     return rpp::utils::none{};                                                               \
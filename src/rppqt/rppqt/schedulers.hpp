@@ -17,4 +17,5 @@
  * @ingroup rppqt
  */
 
-#include <rppqt/schedulers/main_thread.hpp>
\ No newline at end of file
+#include <rppqt/schedulers/main_thread.hpp>
+#include <rppqt/schedulers/thread_pool.hpp>
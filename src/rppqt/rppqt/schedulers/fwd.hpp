@@ -13,4 +13,5 @@
 namespace rppqt::schedulers
 {
     class main_thread;
+    class thread_pool_scheduler;
 } // namespace rppqt::schedulers
@@ -10,20 +10,218 @@
 
 #pragma once
 
+#include <rpp/schedulers/details/queue.hpp>  // schedulable
 #include <rpp/schedulers/details/worker.hpp> // worker
 
 #include <rppqt/schedulers/fwd.hpp> // own forwarding
 #include <rppqt/utils/exceptions.hpp>
 
 #include <QCoreApplication>
+#include <QMetaObject>
+#include <QPointer>
 #include <QTimer>
+#include <algorithm>
 #include <chrono>
 #include <concepts>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace rppqt::schedulers::details
+{
+    /**
+     * @brief Queue of schedulables of main thread of one QCoreApplication.
+     * @details Schedulables without delay are placed into FIFO queue drained by single posted event per burst: event is posted only when queue transitions from idle to busy. Delayed schedulables are kept in heap by time and served by single QTimer armed to the nearest one from the main thread.
+     */
+    class main_thread_queue final : public std::enable_shared_from_this<main_thread_queue>
+    {
+        struct delayed
+        {
+            std::shared_ptr<rpp::schedulers::details::schedulable_base> schedulable;
+            uint64_t                                                    seq;
+
+            // std::push_heap keeps max element at front: "bigger" is one with earlier time
+            bool operator<(const delayed& other) const
+            {
+                const auto l = schedulable->get_timepoint();
+                const auto r = other.schedulable->get_timepoint();
+                if (l != r)
+                    return l > r;
+                return seq > other.seq;
+            }
+        };
+
+    public:
+        explicit main_thread_queue(QCoreApplication* application)
+            : m_application{application}
+        {
+        }
+
+        /**
+         * @brief Obtains queue of current application. Queue is dropped together with application.
+         */
+        static std::shared_ptr<main_thread_queue> get_instance()
+        {
+            const auto application = QCoreApplication::instance();
+            if (!application)
+                throw utils::no_active_qapplication{"Pointer to application is null. Create QApplication before using main_thread_scheduler!"};
+
+            auto&           storage = get_storage();
+            std::lock_guard lock{storage.mutex};
+            if (!storage.instance)
+            {
+                storage.instance = std::make_shared<main_thread_queue>(application);
+                QObject::connect(application, &QObject::destroyed, [] {
+                    auto&           storage = get_storage();
+                    std::lock_guard lock{storage.mutex};
+                    storage.instance.reset();
+                });
+            }
+            return storage.instance;
+        }
+
+        void emplace(rpp::schedulers::time_point timepoint, std::shared_ptr<rpp::schedulers::details::schedulable_base>&& schedulable)
+        {
+            schedulable->set_timepoint(timepoint);
+            {
+                std::lock_guard lock{m_mutex};
+                if (timepoint <= now())
+                {
+                    m_ready.push_back(std::move(schedulable));
+                }
+                else
+                {
+                    m_delayed.push_back(delayed{std::move(schedulable), m_seq++});
+                    std::push_heap(m_delayed.begin(), m_delayed.end());
+                    // timer can be re-armed only from main thread: drain is needed only if new schedulable is the nearest one
+                    if (m_delayed.front().seq != m_seq - 1)
+                        return;
+                }
+
+                if (std::exchange(m_is_drain_posted, true))
+                    return;
+            }
+            post_drain();
+        }
+
+        static rpp::schedulers::time_point now() { return rpp::schedulers::clock_type::now(); }
+
+    private:
+        struct storage_t
+        {
+            std::mutex                         mutex{};
+            std::shared_ptr<main_thread_queue> instance{};
+        };
+
+        static storage_t& get_storage()
+        {
+            static storage_t s_storage{};
+            return s_storage;
+        }
+
+        void post_drain()
+        {
+            QMetaObject::invokeMethod(
+                m_application,
+                [weak = weak_from_this()] {
+                    if (const auto queue = weak.lock())
+                        queue->drain();
+                },
+                Qt::QueuedConnection);
+        }
+
+        /**
+         * @brief Executes all schedulables being ready at the moment of call. Schedulables scheduled during drain are executed by next posted event, so, Qt's event loop is not starved by recursive scheduling.
+         */
+        void drain()
+        {
+            std::deque<std::shared_ptr<rpp::schedulers::details::schedulable_base>> batch{};
+            {
+                std::lock_guard lock{m_mutex};
+                m_is_drain_posted = true;
+                std::swap(batch, m_ready);
+                const auto now_tp = now();
+                while (!m_delayed.empty() && m_delayed.front().schedulable->get_timepoint() <= now_tp)
+                {
+                    std::pop_heap(m_delayed.begin(), m_delayed.end());
+                    batch.push_back(std::move(m_delayed.back().schedulable));
+                    m_delayed.pop_back();
+                }
+            }
+
+            for (auto& schedulable : batch)
+            {
+                if (schedulable->is_disposed())
+                    continue;
+
+                if (const auto timepoint = (*schedulable)())
+                    emplace(timepoint.value(), std::move(schedulable));
+            }
+
+            std::optional<rpp::schedulers::time_point> nearest{};
+            {
+                std::lock_guard lock{m_mutex};
+                if (!m_ready.empty())
+                {
+                    post_drain();
+                    return;
+                }
+
+                m_is_drain_posted = false;
+                if (!m_delayed.empty())
+                    nearest = m_delayed.front().schedulable->get_timepoint();
+            }
+
+            if (nearest)
+                arm_timer(nearest.value());
+        }
+
+        void arm_timer(rpp::schedulers::time_point timepoint)
+        {
+            if (!m_timer)
+            {
+                auto* timer = new QTimer(m_application);
+                timer->setSingleShot(true);
+                timer->setTimerType(Qt::PreciseTimer);
+                QObject::connect(timer, &QTimer::timeout, m_application, [weak = weak_from_this()] {
+                    if (const auto queue = weak.lock())
+                        queue->drain();
+                });
+                m_timer = timer;
+            }
+
+            // round up: schedulable is never executed earlier than requested (and if it is not ready yet, timer is just re-armed)
+            const auto delay = std::chrono::ceil<std::chrono::milliseconds>(std::max(timepoint - now(), rpp::schedulers::duration{}));
+            m_timer->start(static_cast<int>(delay.count()));
+        }
+
+        QCoreApplication* const m_application;
+
+        std::mutex                                                              m_mutex{};
+        std::deque<std::shared_ptr<rpp::schedulers::details::schedulable_base>> m_ready{};
+        std::vector<delayed>                                                    m_delayed{};
+        uint64_t                                                                m_seq{};
+        bool                                                                    m_is_drain_posted{};
+
+        // touched from main thread only
+        QPointer<QTimer> m_timer{};
+    };
+} // namespace rppqt::schedulers::details
 
 namespace rppqt::schedulers
 {
     /**
      * @brief Schedule provided schedulables to main GUI QT thread (where QApplication placed)
+     *
+     * @details All workers share single queue bound to the application: schedulables without delay are executed by single posted event per burst of schedulings (instead of event/timer per schedulable), delayed schedulables are served by single QTimer armed to the nearest one.
+     *
+     * @par Performance notes:
+     * - 1 heap allocation per schedulable, no Qt objects/events per schedulable
+     * - Mutex is acquired to place schedulable into queue and once per burst by main thread
+     * - Delays are not truncated to milliseconds: schedulable is executed not earlier than requested time point
+     *
      * @ingroup qt_schedulers
      */
     class main_thread_scheduler final
@@ -33,21 +231,16 @@ namespace rppqt::schedulers
         {
         public:
             template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, rpp::schedulers::constraint::schedulable_fn<Handler, Args...> Fn>
-            static void defer_for(rpp::schedulers::duration duration, Fn&& fn, Handler&& handler, Args&&... args)
+            static void defer_to(rpp::schedulers::time_point timepoint, Fn&& fn, Handler&& handler, Args&&... args)
             {
-                const auto application = QCoreApplication::instance();
-                if (!application)
-                    throw utils::no_active_qapplication{"Pointer to application is null. Create QApplication before using main_thread_scheduler!"};
+                using schedulable_t = rpp::schedulers::details::specific_schedulable<worker_strategy, std::decay_t<Fn>, std::decay_t<Handler>, std::decay_t<Args>...>;
 
-                QTimer::singleShot(std::chrono::duration_cast<std::chrono::milliseconds>(duration), application, [fn = std::forward<Fn>(fn), handler = std::forward<Handler>(handler), ... args = std::forward<Args>(args)]() mutable {
-                    if (const auto new_duration = fn(handler, args...))
-                        defer_for(new_duration->value, std::move(fn), std::move(handler), std::move(args)...);
-                });
+                details::main_thread_queue::get_instance()->emplace(timepoint, std::make_shared<schedulable_t>(timepoint, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...));
             }
 
             static constexpr rpp::schedulers::details::none_disposable get_disposable() { return {}; }
 
-            static rpp::schedulers::time_point now() { return rpp::schedulers::clock_type::now(); }
+            static rpp::schedulers::time_point now() { return details::main_thread_queue::now(); }
         };
 
     public:
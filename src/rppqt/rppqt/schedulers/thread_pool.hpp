@@ -0,0 +1,230 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2022 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/disposables/details/base_disposable.hpp>
+#include <rpp/disposables/disposable_wrapper.hpp>
+#include <rpp/schedulers/details/queue.hpp>  // schedulable
+#include <rpp/schedulers/details/worker.hpp> // worker
+#include <rpp/schedulers/new_thread.hpp>
+
+#include <rppqt/schedulers/fwd.hpp> // own forwarding
+
+#include <QThreadPool>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace rppqt::schedulers::details
+{
+    /**
+     * @brief Serialized queue of schedulables executed on threads of QThreadPool.
+     * @details Only one pool's task per strand is submitted at any time: task is submitted when queue transitions from idle to busy and it drains schedulables being ready at the moment of its start. If there are more schedulables after that, strand re-submits itself to the end of the pool's queue, so, other strands are not starved by busy one.
+     * @details Delayed schedulables are kept by single timer thread shared among all strands and moved to queue of strand when they are ready.
+     */
+    class thread_pool_strand final : public rpp::details::base_disposable
+        , public rpp::details::enable_wrapper_from_this<thread_pool_strand>
+    {
+        using schedulable_ptr = std::shared_ptr<rpp::schedulers::details::schedulable_base>;
+
+        struct timer_handler
+        {
+            std::weak_ptr<thread_pool_strand> strand;
+
+            bool is_disposed() const
+            {
+                const auto ptr = strand.lock();
+                return !ptr || ptr->is_disposed();
+            }
+
+            void on_error(const std::exception_ptr&) const {}
+        };
+
+    public:
+        explicit thread_pool_strand(QThreadPool* pool)
+            : m_pool{pool}
+        {
+        }
+
+        void emplace(rpp::schedulers::time_point timepoint, schedulable_ptr&& schedulable)
+        {
+            if (is_disposed())
+                return;
+
+            schedulable->set_timepoint(timepoint);
+            if (timepoint > now())
+            {
+                get_timer().schedule(
+                    timepoint,
+                    [](const timer_handler& handler, schedulable_ptr& schedulable) -> rpp::schedulers::optional_delay_to {
+                        if (const auto strand = handler.strand.lock())
+                            strand->push(std::move(schedulable));
+                        return std::nullopt;
+                    },
+                    timer_handler{this->wrapper_from_this().lock()},
+                    std::move(schedulable));
+                return;
+            }
+
+            push(std::move(schedulable));
+        }
+
+        static rpp::schedulers::time_point now() { return rpp::schedulers::clock_type::now(); }
+
+    private:
+        static const rpp::schedulers::new_thread::worker_strategy& get_timer_strategy()
+        {
+            static const rpp::schedulers::new_thread::worker_strategy s_timer{};
+            return s_timer;
+        }
+
+        static rpp::schedulers::worker<rpp::schedulers::new_thread::worker_strategy> get_timer()
+        {
+            return rpp::schedulers::worker<rpp::schedulers::new_thread::worker_strategy>{get_timer_strategy()};
+        }
+
+        void push(schedulable_ptr&& schedulable)
+        {
+            {
+                std::lock_guard lock{m_mutex};
+                if (is_disposed())
+                    return;
+
+                m_queue.push_back(std::move(schedulable));
+                if (std::exchange(m_is_submitted, true))
+                    return;
+            }
+            submit();
+        }
+
+        void submit()
+        {
+            m_pool->start([self = this->wrapper_from_this().lock()] { self->drain(); });
+        }
+
+        void drain()
+        {
+            std::deque<schedulable_ptr> batch{};
+            {
+                std::lock_guard lock{m_mutex};
+                std::swap(batch, m_queue);
+            }
+
+            for (auto& schedulable : batch)
+            {
+                if (is_disposed())
+                    return;
+
+                if (schedulable->is_disposed())
+                    continue;
+
+                if (const auto timepoint = (*schedulable)())
+                    emplace(timepoint.value(), std::move(schedulable));
+            }
+
+            {
+                std::lock_guard lock{m_mutex};
+                if (m_queue.empty() || is_disposed())
+                {
+                    m_is_submitted = false;
+                    return;
+                }
+            }
+            submit();
+        }
+
+        void base_dispose_impl(interface_disposable::Mode) noexcept override
+        {
+            std::deque<schedulable_ptr> queue{};
+            {
+                std::lock_guard lock{m_mutex};
+                std::swap(queue, m_queue);
+            }
+            // destroy schedulables (and their handlers) outside of lock
+        }
+
+        QThreadPool* const m_pool;
+
+        std::mutex                  m_mutex{};
+        std::deque<schedulable_ptr> m_queue{};
+        bool                        m_is_submitted{};
+    };
+} // namespace rppqt::schedulers::details
+
+namespace rppqt::schedulers
+{
+    /**
+     * @brief Schedules provided schedulables to threads of QThreadPool.
+     *
+     * @details Each worker is a "strand": schedulables of the same worker are executed serially in FIFO order (never concurrently with each other), but possibly on different threads of pool. Different workers share threads of pool, so, a lot of workers can be created without thread per worker (unlike rpp::schedulers::new_thread).
+     * @details Worker is disposed when it (and all observers using it) is destroyed or explicitly disposed: its pending schedulables are dropped.
+     *
+     * @par Performance notes:
+     * - 1 heap allocation per schedulable and per worker
+     * - Mutex is acquired to place schedulable into queue of worker and once per batch by pool's thread
+     * - Pool's task is submitted once per idle-to-busy transition of worker, not per schedulable
+     * - Delayed schedulables are waited by single thread shared among all workers of all pools
+     *
+     * @par Example
+     * \code{.cpp}
+     * rpp::source::just(1, 2, 3)
+     *   | rpp::ops::observe_on(rppqt::schedulers::thread_pool_scheduler{})
+     *   | rpp::ops::subscribe([](int v) { heavy_computation(v); });
+     * \endcode
+     *
+     * @warning Pool should outlive all workers created from this scheduler
+     *
+     * @ingroup qt_schedulers
+     */
+    class thread_pool_scheduler final
+    {
+    private:
+        class worker_strategy
+        {
+        public:
+            explicit worker_strategy(QThreadPool* pool)
+                : m_strand{rpp::disposable_wrapper_impl<details::thread_pool_strand>::make(pool)}
+            {
+            }
+
+            template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, rpp::schedulers::constraint::schedulable_fn<Handler, Args...> Fn>
+            void defer_to(rpp::schedulers::time_point timepoint, Fn&& fn, Handler&& handler, Args&&... args) const
+            {
+                using schedulable_t = rpp::schedulers::details::specific_schedulable<worker_strategy, std::decay_t<Fn>, std::decay_t<Handler>, std::decay_t<Args>...>;
+
+                if (const auto strand = m_strand.lock())
+                    strand->emplace(timepoint, std::make_shared<schedulable_t>(timepoint, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...));
+            }
+
+            rpp::disposable_wrapper get_disposable() const { return m_strand; }
+
+            static rpp::schedulers::time_point now() { return details::thread_pool_strand::now(); }
+
+        private:
+            rpp::disposable_wrapper_impl<details::thread_pool_strand> m_strand;
+        };
+
+    public:
+        explicit thread_pool_scheduler(QThreadPool* pool = QThreadPool::globalInstance())
+            : m_pool{pool}
+        {
+        }
+
+        rpp::schedulers::worker<worker_strategy> create_worker() const
+        {
+            return rpp::schedulers::worker<worker_strategy>{m_pool};
+        }
+
+    private:
+        QThreadPool* m_pool;
+    };
+} // namespace rppqt::schedulers
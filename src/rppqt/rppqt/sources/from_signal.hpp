@@ -14,8 +14,15 @@
 
 #include <rppqt/sources/fwd.hpp>
 
+#include <QMetaObject>
 #include <QObject>
+#include <QTimer>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <tuple>
+#include <utility>
 
 namespace rppqt::details
 {
@@ -57,6 +64,113 @@ namespace rppqt::details
             observer.on_next(rpp::utils::none{});
         }
     };
+
+    /**
+     * @brief Keeps latest value of signal and delivers it to object's thread at most once per event-loop iteration (or per `interval`).
+     * @details Signal can be emitted from any thread: it only replaces latest value under lock and posts delivery event only if there is no pending one yet.
+     */
+    template<rpp::constraint::decayed_type Type>
+    class from_signal_coalescing_state final : public std::enable_shared_from_this<from_signal_coalescing_state<Type>>
+    {
+    public:
+        from_signal_coalescing_state(const QObject* object, std::chrono::milliseconds interval)
+            : m_object{const_cast<QObject*>(object)}
+            , m_interval{interval}
+        {
+        }
+
+        template<typename TT>
+        void on_signal(TT&& v)
+        {
+            {
+                std::lock_guard lock{m_mutex};
+                m_value.emplace(std::forward<TT>(v));
+                if (std::exchange(m_is_delivery_posted, true))
+                    return;
+            }
+            // event is bound to object: it is dropped if object is destroyed before delivery
+            QMetaObject::invokeMethod(
+                m_object,
+                [weak = this->weak_from_this()] {
+                    if (const auto state = weak.lock())
+                        state->deliver();
+                },
+                Qt::QueuedConnection);
+        }
+
+        // object is already destroyed (only QObject part is alive), so, pending value is dropped: observers would likely access object to handle it
+        void on_destroyed()
+        {
+            {
+                std::lock_guard lock{m_mutex};
+                m_value.reset();
+            }
+            m_subject.get_observer().on_completed();
+        }
+
+        auto get_observable() const { return m_subject.get_observable(); }
+
+    private:
+        // called from object's thread only
+        void deliver()
+        {
+            if (m_interval != std::chrono::milliseconds{})
+            {
+                const auto now = std::chrono::steady_clock::now();
+                if (m_last_delivery && now - m_last_delivery.value() < m_interval)
+                {
+                    const auto delay = std::chrono::ceil<std::chrono::milliseconds>(m_interval - (now - m_last_delivery.value()));
+                    QTimer::singleShot(static_cast<int>(delay.count()), m_object, [weak = this->weak_from_this()] {
+                        if (const auto state = weak.lock())
+                            state->deliver();
+                    });
+                    return;
+                }
+                m_last_delivery = now;
+            }
+            flush();
+        }
+
+        void flush()
+        {
+            std::optional<Type> value{};
+            {
+                std::lock_guard lock{m_mutex};
+                std::swap(value, m_value);
+                m_is_delivery_posted = false;
+            }
+            if (value)
+                m_subject.get_observer().on_next(std::move(value).value());
+        }
+
+        QObject* const                                       m_object;
+        const std::chrono::milliseconds                      m_interval;
+        rpp::subjects::publish_subject<Type>                 m_subject{};
+        std::optional<std::chrono::steady_clock::time_point> m_last_delivery{};
+
+        std::mutex          m_mutex{};
+        std::optional<Type> m_value{};
+        bool                m_is_delivery_posted{};
+    };
+
+    template<typename... Args>
+    struct from_signal_coalescing_on_event
+    {
+        using value_type = rpp::utils::extract_observer_type_t<decltype(from_signal_on_event<Args...>::observer)>;
+
+        std::shared_ptr<from_signal_coalescing_state<value_type>> state;
+
+        template<typename... Vals>
+        void operator()(Vals&&... vals) const
+        {
+            if constexpr (sizeof...(Args) == 0)
+                state->on_signal(rpp::utils::none{});
+            else if constexpr (sizeof...(Args) == 1)
+                state->on_signal(std::forward<Vals>(vals)...);
+            else
+                state->on_signal(std::make_tuple(std::forward<Vals>(vals)...));
+        }
+    };
 } // namespace rppqt::details
 
 namespace rppqt::source
@@ -83,4 +197,37 @@ namespace rppqt::source
 
         return subj.get_observable();
     }
+
+    /**
+     * @brief Creates rpp::observable that emits latest item from provided QT signal at most once per event-loop iteration of object's thread (or at most once per `interval`)
+     *
+     * @details Unlike rppqt::source::from_signal, emissions of signal are not forwarded immediately: signal only replaces latest value and emission of this value is posted to thread of object. All emissions of signal happened before delivery are coalesced into one emission of latest value. As a result, high-rate signals (mouse moves, progress or sensor updates emitted from worker threads) don't flood observers.
+     * @details Observers are always called from thread of object (where its event loop is running). When object is destroyed, latest pending (not emitted yet) value is dropped and observable just completes: derived part of object is already destroyed at this moment, so, observers must not be called with values which they could handle by accessing object.
+     *
+     * @par Performance notes:
+     * - 1 heap allocation for state per call
+     * - Signal can be emitted from any thread: mutex is acquired just to replace latest value, event is posted only if there is no pending one
+     *
+     * @param object is QObject which would emit signals
+     * @param signal is interested signal which would generate emissions for observable. Expected to obtain pointer to member function representing signal
+     * @param interval is minimal interval between emissions (for example, frame interval). Zero means at most once per event-loop iteration.
+     *
+     * @warning #include <rppqt/sources/from_signal.hpp>
+     *
+     * @par Examples:
+     * @snippet from_signal.cpp from_signal_coalesced
+     *
+     * @ingroup qt_creational_operators
+     */
+    template<std::derived_from<QObject> TSignalQObject, std::derived_from<TSignalQObject> TObject, typename R, typename... Args>
+    auto from_signal_coalesced(const TObject& object, R (TSignalQObject::*signal)(Args...), std::chrono::milliseconds interval)
+    {
+        using on_next_impl = details::from_signal_coalescing_on_event<Args...>;
+        const auto state   = std::make_shared<details::from_signal_coalescing_state<typename on_next_impl::value_type>>(&object, interval);
+
+        QObject::connect(&object, signal, on_next_impl{state});
+        QObject::connect(&object, &QObject::destroyed, [state] { state->on_destroyed(); });
+
+        return state->get_observable();
+    }
 } // namespace rppqt::source
@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <concepts>
 
 class QObject;
@@ -18,4 +19,7 @@ namespace rppqt::source
 {
     template<std::derived_from<QObject> TSignalQObject, std::derived_from<TSignalQObject> TObject, typename R, typename... Args>
     auto from_signal(const TObject& object, R (TSignalQObject::*signal)(Args...));
+
+    template<std::derived_from<QObject> TSignalQObject, std::derived_from<TSignalQObject> TObject, typename R, typename... Args>
+    auto from_signal_coalesced(const TObject& object, R (TSignalQObject::*signal)(Args...), std::chrono::milliseconds interval = {});
 } // namespace rppqt::source
@@ -0,0 +1,125 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#include <snitch/snitch.hpp>
+
+#include <rpp/operators/adaptive_batch.hpp>
+#include <rpp/schedulers/run_loop.hpp>
+#include <rpp/subjects/publish_subject.hpp>
+
+#include "disposable_observable.hpp"
+#include "mock_observer.hpp"
+#include "test_scheduler.hpp"
+
+TEST_CASE("adaptive_batch emits singletons while observer is idle")
+{
+    auto run_loop = rpp::schedulers::run_loop{};
+    auto mock     = mock_observer_strategy<std::vector<int>>{};
+    auto subj     = rpp::subjects::publish_subject<int>{};
+
+    subj.get_observable() | rpp::ops::adaptive_batch(3, std::chrono::hours{1}, run_loop) | rpp::ops::subscribe(mock);
+
+    subj.get_observer().on_next(1);
+    while (!run_loop.is_empty())
+        run_loop.dispatch();
+    subj.get_observer().on_next(2);
+    while (!run_loop.is_empty())
+        run_loop.dispatch();
+
+    CHECK(mock.get_received_values() == std::vector<std::vector<int>>{{1}, {2}});
+
+    SECTION("on_completed forwarded immediately")
+    {
+        subj.get_observer().on_completed();
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+}
+
+TEST_CASE("adaptive_batch grows batches while observer is busy")
+{
+    auto run_loop = rpp::schedulers::run_loop{};
+    auto mock     = mock_observer_strategy<std::vector<int>>{};
+    auto subj     = rpp::subjects::publish_subject<int>{};
+
+    SECTION("emissions arrived before scheduled batch processed are joined up to max_size")
+    {
+        subj.get_observable() | rpp::ops::adaptive_batch(2, std::chrono::nanoseconds{0}, run_loop) | rpp::ops::subscribe(mock);
+
+        for (int i = 1; i < 6; ++i)
+            subj.get_observer().on_next(i);
+        subj.get_observer().on_completed();
+
+        CHECK(mock.get_total_on_next_count() == 0);
+
+        while (!run_loop.is_empty())
+            run_loop.dispatch();
+
+        CHECK(mock.get_received_values() == std::vector<std::vector<int>>{{1, 2}, {3, 4}, {5}});
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SECTION("emissions arrived during processing of batch")
+    {
+        auto       max_delay = std::chrono::hours{1};
+        const auto observer  = mock.get_observer();
+        subj.get_observable()
+            | rpp::ops::adaptive_batch(3, max_delay, run_loop)
+            | rpp::ops::subscribe([&](const std::vector<int>& v) {
+                  observer.on_next(v);
+                  if (v == std::vector{1})
+                  {
+                      subj.get_observer().on_next(2);
+                      subj.get_observer().on_next(3);
+                  }
+              },
+                                  [&](const std::exception_ptr& err) { observer.on_error(err); },
+                                  [&]() { observer.on_completed(); });
+
+        subj.get_observer().on_next(1);
+        run_loop.dispatch();
+
+        SECTION("wait for batch to be filled")
+        {
+            CHECK(mock.get_received_values() == std::vector<std::vector<int>>{{1}});
+            CHECK(!run_loop.is_any_ready_schedulable());
+
+            SECTION("full batch emitted immediately")
+            {
+                subj.get_observer().on_next(4);
+                run_loop.dispatch();
+
+                CHECK(mock.get_received_values() == std::vector<std::vector<int>>{{1}, {2, 3, 4}});
+            }
+
+            SECTION("on_completed emits pending batch without waiting")
+            {
+                subj.get_observer().on_completed();
+                run_loop.dispatch();
+
+                CHECK(mock.get_received_values() == std::vector<std::vector<int>>{{1}, {2, 3}});
+                CHECK(mock.get_on_completed_count() == 1);
+            }
+
+            SECTION("on_error drops pending batch")
+            {
+                subj.get_observer().on_error({});
+                run_loop.dispatch();
+
+                CHECK(mock.get_received_values() == std::vector<std::vector<int>>{{1}});
+                CHECK(mock.get_on_error_count() == 1);
+            }
+        }
+    }
+}
+
+TEST_CASE("adaptive_batch satisfies disposable contracts")
+{
+    test_operator_with_disposable<int>(rpp::ops::adaptive_batch(2, std::chrono::seconds{1}, test_scheduler{}));
+}
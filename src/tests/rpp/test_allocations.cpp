@@ -0,0 +1,120 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#include <snitch/snitch.hpp>
+
+#include <rpp/observers/lambda_observer.hpp>
+#include <rpp/operators/filter.hpp>
+#include <rpp/operators/map.hpp>
+#include <rpp/operators/scan.hpp>
+#include <rpp/operators/skip.hpp>
+#include <rpp/operators/subscribe.hpp>
+#include <rpp/operators/take.hpp>
+#include <rpp/operators/take_while.hpp>
+#include <rpp/schedulers/immediate.hpp>
+#include <rpp/sources/create.hpp>
+#include <rpp/sources/from.hpp>
+#include <rpp/sources/just.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <functional>
+#include <new>
+
+namespace
+{
+    std::atomic_size_t s_allocations_count{};
+
+    template<typename Fn>
+    size_t count_allocations(Fn&& fn)
+    {
+        const auto before = s_allocations_count.load();
+        fn();
+        return s_allocations_count.load() - before;
+    }
+
+    // type-erased observable is allocated on heap, so, chain is expected to be allocation-free only while it is shorter than RPP_TYPE_ERASURE_CHAIN_THRESHOLD
+    template<size_t Operators>
+    constexpr bool is_allocation_free = RPP_TYPE_ERASURE_CHAIN_THRESHOLD == 0 || Operators < RPP_TYPE_ERASURE_CHAIN_THRESHOLD;
+} // namespace
+
+void* operator new(std::size_t size)
+{
+    ++s_allocations_count;
+    if (auto* ptr = std::malloc(size))
+        return ptr;
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+TEST_CASE("fully synchronous chains subscribe without heap allocations")
+{
+    int sink{};
+
+    SECTION("create + subscribe with lambdas")
+    {
+        CHECK((count_allocations([&] {
+                  rpp::source::create<int>([](const auto& obs) { obs.on_next(1); obs.on_completed(); })
+                      .subscribe([&](int v) { sink = v; });
+              })
+              == 0)
+              == is_allocation_free<0>);
+    }
+
+    SECTION("just + map + filter + subscribe")
+    {
+        CHECK((count_allocations([&] {
+                  rpp::source::just(rpp::schedulers::immediate{}, 1, 2, 3)
+                      | rpp::operators::map([](int v) { return v * 2; })
+                      | rpp::operators::filter([](int v) { return v > 2; })
+                      | rpp::operators::subscribe([&](int v) { sink = v; });
+              })
+              == 0)
+              == is_allocation_free<2>);
+    }
+
+    SECTION("from_iterable + take_while + skip + take + scan + subscribe")
+    {
+        const std::array<int, 5> vals{1, 2, 3, 4, 5};
+        CHECK((count_allocations([&] {
+                  rpp::source::from_iterable(vals, rpp::schedulers::immediate{})
+                      | rpp::operators::take_while([](int v) { return v < 5; })
+                      | rpp::operators::skip(1)
+                      | rpp::operators::take(2)
+                      | rpp::operators::scan(0, std::plus<int>{})
+                      | rpp::operators::subscribe([&](int v) { sink = v; });
+              })
+              == 0)
+              == is_allocation_free<4>);
+    }
+
+    SECTION("just + map + subscribe with observer")
+    {
+        CHECK((count_allocations([&] {
+                  rpp::source::just(rpp::schedulers::immediate{}, 1)
+                      | rpp::operators::map([](int v) { return v * 2; })
+                      | rpp::operators::subscribe(rpp::make_lambda_observer([&](int v) { sink = v; }));
+              })
+              == 0)
+              == is_allocation_free<1>);
+    }
+
+    CHECK(sink != 0);
+}
@@ -0,0 +1,283 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#include <snitch/snitch.hpp>
+
+#include <rpp/operators/as_blocking.hpp>
+#include <rpp/operators/concat.hpp>
+#include <rpp/operators/filter.hpp>
+#include <rpp/operators/flat_map.hpp>
+#include <rpp/operators/merge.hpp>
+#include <rpp/operators/observe_on.hpp>
+#include <rpp/operators/reduce.hpp>
+#include <rpp/operators/subscribe.hpp>
+#include <rpp/operators/take.hpp>
+#include <rpp/schedulers/immediate.hpp>
+#include <rpp/schedulers/new_thread.hpp>
+#include <rpp/schedulers/run_loop.hpp>
+#include <rpp/sources/create.hpp>
+#include <rpp/sources/from.hpp>
+#include <rpp/sources/interval.hpp>
+#include <rpp/sources/just.hpp>
+
+#include "mock_observer.hpp"
+#include "snitch_logging.hpp"
+#include "test_scheduler.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+
+namespace
+{
+    struct producer_state
+    {
+        int    count;
+        int    offered{};
+        size_t max_in_flight{};
+
+        void update_in_flight(const mock_observer_strategy<int>& mock)
+        {
+            max_in_flight = std::max(max_in_flight, static_cast<size_t>(offered) - mock.get_received_values().size());
+        }
+    };
+
+    auto make_on_demand_producer(const std::shared_ptr<producer_state>& state, const mock_observer_strategy<int>& mock)
+    {
+        return rpp::source::create_on_demand<int>([state, mock](const rpp::demand_emitter<int>& emitter) {
+            auto produce = [state, mock, emitter] {
+                while (state->offered < state->count)
+                {
+                    if (!emitter.offer(state->offered))
+                        return;
+
+                    ++state->offered;
+                    state->update_in_flight(mock);
+                }
+                emitter.on_completed();
+            };
+
+            emitter.on_demand_available(produce);
+            produce();
+        });
+    }
+
+    std::vector<int> make_values(int count)
+    {
+        std::vector<int> values(static_cast<size_t>(count));
+        std::iota(values.begin(), values.end(), 0);
+        return values;
+    }
+} // namespace
+
+TEST_CASE("on_demand sources behave as usual without demand-aware consumer")
+{
+    auto mock = mock_observer_strategy<int>{};
+
+    SECTION("from_iterable_on_demand")
+    {
+        rpp::source::from_iterable_on_demand(make_values(5), rpp::schedulers::immediate{}) | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_received_values() == make_values(5));
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SECTION("create_on_demand")
+    {
+        auto state = std::make_shared<producer_state>(producer_state{.count = 5});
+        make_on_demand_producer(state, mock) | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_received_values() == make_values(5));
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SECTION("interval_on_demand")
+    {
+        auto scheduler = test_scheduler{};
+        auto sizes     = mock_observer_strategy<size_t>{};
+        rpp::source::interval_on_demand(std::chrono::seconds{1}, scheduler) | rpp::ops::take(3) | rpp::ops::subscribe(sizes);
+
+        for (size_t i = 0; i < 3; ++i)
+            scheduler.time_advance(std::chrono::seconds{1});
+
+        CHECK(sizes.get_received_values() == std::vector<size_t>{0, 1, 2});
+        CHECK(sizes.get_on_completed_count() == 1);
+    }
+}
+
+TEST_CASE("observe_on_bounded limits amount of items in flight for demand-aware upstream")
+{
+    auto mock     = mock_observer_strategy<int>{};
+    auto run_loop = rpp::schedulers::run_loop{};
+
+    SECTION("create_on_demand producer offers no more than requested")
+    {
+        auto state = std::make_shared<producer_state>(producer_state{.count = 20});
+        make_on_demand_producer(state, mock) | rpp::ops::observe_on_bounded(run_loop, 3) | rpp::ops::subscribe(mock);
+
+        CHECK(state->offered == 3);
+        CHECK(mock.get_received_values().empty());
+
+        while (!run_loop.is_empty())
+            run_loop.dispatch_if_ready();
+
+        CHECK(mock.get_received_values() == make_values(20));
+        CHECK(mock.get_on_completed_count() == 1);
+        CHECK(state->max_in_flight <= 3);
+    }
+
+    SECTION("from_iterable_on_demand pauses and resumes emissions")
+    {
+        rpp::source::from_iterable_on_demand(make_values(10), rpp::schedulers::immediate{}) | rpp::ops::observe_on_bounded(run_loop, 2) | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_received_values().empty());
+
+        while (!run_loop.is_empty())
+            run_loop.dispatch_if_ready();
+
+        CHECK(mock.get_received_values() == make_values(10));
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SECTION("merge forwards demand to inner observables")
+    {
+        auto first  = std::make_shared<producer_state>(producer_state{.count = 10});
+        auto second = std::make_shared<producer_state>(producer_state{.count = 10});
+        make_on_demand_producer(first, mock) | rpp::ops::merge_with(make_on_demand_producer(second, mock)) | rpp::ops::observe_on_bounded(run_loop, 2) | rpp::ops::subscribe(mock);
+
+        CHECK(first->offered + second->offered == 2);
+
+        while (!run_loop.is_empty())
+        {
+            run_loop.dispatch_if_ready();
+            CHECK(static_cast<size_t>(first->offered + second->offered) - mock.get_received_values().size() <= 2);
+        }
+
+        CHECK(mock.get_received_values().size() == 20);
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SECTION("merge shares demand between many inner observables")
+    {
+        std::vector<std::shared_ptr<producer_state>> states{};
+        for (size_t i = 0; i < 5; ++i)
+            states.push_back(std::make_shared<producer_state>(producer_state{.count = 3}));
+
+        const auto total_offered = [&states] {
+            size_t result{};
+            for (const auto& state : states)
+                result += static_cast<size_t>(state->offered);
+            return result;
+        };
+
+        rpp::source::from_iterable(states)
+            | rpp::ops::flat_map([&mock](const std::shared_ptr<producer_state>& state) { return make_on_demand_producer(state, mock); })
+            | rpp::ops::observe_on_bounded(run_loop, 2)
+            | rpp::ops::subscribe(mock);
+
+        CHECK(total_offered() == 2);
+
+        while (!run_loop.is_empty())
+        {
+            run_loop.dispatch_if_ready();
+            CHECK(total_offered() - mock.get_received_values().size() <= 2);
+        }
+
+        CHECK(mock.get_received_values().size() == 15);
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SECTION("concat forwards demand to current inner observable")
+    {
+        rpp::source::just(rpp::source::from_iterable_on_demand(make_values(5), rpp::schedulers::immediate{}),
+                          rpp::source::from_iterable_on_demand(make_values(5), rpp::schedulers::immediate{}))
+            | rpp::ops::concat()
+            | rpp::ops::observe_on_bounded(run_loop, 2)
+            | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_received_values().empty());
+
+        while (!run_loop.is_empty())
+            run_loop.dispatch_if_ready();
+
+        CHECK(mock.get_received_values() == std::vector{0, 1, 2, 3, 4, 0, 1, 2, 3, 4});
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SECTION("filter doesn't forward demand of downstream")
+    {
+        rpp::source::from_iterable_on_demand(make_values(10), rpp::schedulers::immediate{})
+            | rpp::ops::filter([](int v) { return v % 2 == 0; })
+            | rpp::ops::observe_on_bounded(run_loop, 2)
+            | rpp::ops::subscribe(mock);
+
+        while (!run_loop.is_empty())
+            run_loop.dispatch_if_ready();
+
+        CHECK(mock.get_received_values() == std::vector{0, 2, 4, 6, 8});
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SECTION("reduce doesn't forward demand of downstream")
+    {
+        rpp::source::from_iterable_on_demand(make_values(10), rpp::schedulers::immediate{})
+            | rpp::ops::reduce(0, std::plus<int>{})
+            | rpp::ops::observe_on_bounded(run_loop, 2)
+            | rpp::ops::subscribe(mock);
+
+        while (!run_loop.is_empty())
+            run_loop.dispatch_if_ready();
+
+        CHECK(mock.get_received_values() == std::vector{45});
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+}
+
+TEST_CASE("interval_on_demand doesn't lose ticks without demand")
+{
+    auto scheduler = test_scheduler{};
+    auto run_loop  = rpp::schedulers::run_loop{};
+    auto mock      = mock_observer_strategy<size_t>{};
+
+    rpp::source::interval_on_demand(std::chrono::seconds{1}, scheduler) | rpp::ops::observe_on_bounded(run_loop, 1) | rpp::ops::take(3) | rpp::ops::subscribe(mock);
+
+    for (size_t i = 0; i < 5; ++i)
+        scheduler.time_advance(std::chrono::seconds{1});
+
+    SECTION("only requested tick is emitted while consumer is busy")
+    {
+        CHECK(mock.get_received_values().empty());
+        CHECK(scheduler.get_executions().size() == 2);
+    }
+
+    SECTION("ticks continue right after consumer requests more")
+    {
+        while (!run_loop.is_empty())
+            run_loop.dispatch_if_ready();
+        scheduler.time_advance(std::chrono::seconds{1});
+        while (!run_loop.is_empty())
+            run_loop.dispatch_if_ready();
+
+        CHECK(mock.get_received_values() == std::vector<size_t>{0, 1, 2});
+    }
+}
+
+TEST_CASE("observe_on_bounded with demand-aware upstream doesn't lose items between threads")
+{
+    const auto values = make_values(10'000);
+
+    std::vector<int> received{};
+    rpp::source::from_iterable_on_demand(values, rpp::schedulers::new_thread{})
+        | rpp::ops::observe_on_bounded(rpp::schedulers::new_thread{}, 16)
+        | rpp::ops::as_blocking()
+        | rpp::ops::subscribe([&](int v) { received.push_back(v); });
+
+    CHECK(received == values);
+}
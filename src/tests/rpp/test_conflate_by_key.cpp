@@ -0,0 +1,113 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#include <snitch/snitch.hpp>
+
+#include <rpp/operators/conflate_by_key.hpp>
+#include <rpp/operators/subscribe.hpp>
+#include <rpp/schedulers/immediate.hpp>
+#include <rpp/schedulers/run_loop.hpp>
+#include <rpp/sources/error.hpp>
+#include <rpp/sources/just.hpp>
+#include <rpp/subjects/publish_subject.hpp>
+
+#include "disposable_observable.hpp"
+#include "mock_observer.hpp"
+#include "snitch_logging.hpp"
+
+namespace
+{
+    void dispatch_all(const rpp::schedulers::run_loop& run_loop)
+    {
+        while (!run_loop.is_empty())
+            run_loop.dispatch_if_ready();
+    }
+
+    const auto parity = [](int v) { return v % 2; };
+} // namespace
+
+TEST_CASE("conflate_by_key keeps only latest value per key while consumer is busy")
+{
+    auto mock     = mock_observer_strategy<int>{};
+    auto run_loop = rpp::schedulers::run_loop{};
+
+    SECTION("just(1,2,3,5,4) with key x%2")
+    {
+        rpp::source::just(rpp::schedulers::immediate{}, 1, 2, 3, 5, 4) | rpp::ops::conflate_by_key(parity, run_loop) | rpp::ops::subscribe(mock);
+
+        SECTION("nothing emitted till scheduler executes drain")
+        {
+            CHECK(mock.get_received_values().empty());
+            CHECK(mock.get_on_completed_count() == 0);
+        }
+
+        SECTION("latest values emitted in order of first appearance of keys")
+        {
+            dispatch_all(run_loop);
+
+            CHECK(mock.get_received_values() == std::vector{5, 4});
+            CHECK(mock.get_on_completed_count() == 1);
+        }
+    }
+
+    SECTION("values arrived during emission of batch form next batch")
+    {
+        auto subj = rpp::subjects::publish_subject<int>{};
+        subj.get_observable()
+            | rpp::ops::conflate_by_key(parity, run_loop)
+            | rpp::ops::subscribe([&](int v) {
+                  mock.on_next(v);
+                  if (v == 1)
+                  {
+                      subj.get_observer().on_next(3);
+                      subj.get_observer().on_next(2);
+                      subj.get_observer().on_next(5);
+                  }
+              },
+                                  [&](const std::exception_ptr& err) { mock.on_error(err); },
+                                  [&]() { mock.on_completed(); });
+
+        subj.get_observer().on_next(1);
+        dispatch_all(run_loop);
+
+        CHECK(mock.get_received_values() == std::vector{1, 5, 2});
+
+        SECTION("each key is emitted again after new value")
+        {
+            subj.get_observer().on_next(4);
+            subj.get_observer().on_next(6);
+            subj.get_observer().on_completed();
+            dispatch_all(run_loop);
+
+            CHECK(mock.get_received_values() == std::vector{1, 5, 2, 6});
+            CHECK(mock.get_on_completed_count() == 1);
+        }
+    }
+
+    SECTION("error cancels pending values")
+    {
+        auto subj = rpp::subjects::publish_subject<int>{};
+        subj.get_observable() | rpp::ops::conflate_by_key(parity, run_loop) | rpp::ops::subscribe(mock);
+
+        subj.get_observer().on_next(1);
+        subj.get_observer().on_next(2);
+        subj.get_observer().on_error({});
+        dispatch_all(run_loop);
+
+        CHECK(mock.get_received_values().empty());
+        CHECK(mock.get_on_error_count() == 1);
+        CHECK(mock.get_on_completed_count() == 0);
+    }
+}
+
+TEST_CASE("conflate_by_key satisfies disposable contracts")
+{
+    test_operator_with_disposable<int>(rpp::ops::conflate_by_key(parity, rpp::schedulers::immediate{}));
+}
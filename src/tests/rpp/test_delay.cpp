@@ -10,9 +10,12 @@
 
 #include <snitch/snitch.hpp>
 
+#include <rpp/observables/dynamic_observable.hpp>
 #include <rpp/operators/as_blocking.hpp>
 #include <rpp/operators/delay.hpp>
 #include <rpp/operators/observe_on.hpp>
+#include <rpp/schedulers/immediate.hpp>
+#include <rpp/schedulers/run_loop.hpp>
 #include <rpp/sources/empty.hpp>
 #include <rpp/sources/error.hpp>
 #include <rpp/sources/just.hpp>
@@ -288,4 +291,126 @@ TEST_CASE("observe_on forward error immediately")
         CHECK(scheduler.get_schedulings() == std::vector{now + delay_duration});
         CHECK(scheduler.get_executions() == std::vector<rpp::schedulers::time_point>{});
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("observe_on executes inline when already inside run_loop dispatching")
+{
+    auto scheduler = rpp::schedulers::run_loop{};
+    auto mock      = mock_observer_strategy<int>{};
+
+    SECTION("subscribe outside of run_loop")
+    {
+        rpp::source::just(rpp::schedulers::immediate{}, 1, 2, 3)
+            | rpp::ops::observe_on(scheduler)
+            | rpp::ops::subscribe(mock);
+
+        SECTION("nothing happens till dispatching")
+        {
+            CHECK(mock.get_received_values() == std::vector<int>{});
+            CHECK(scheduler.get_elided_hops_count() == 0);
+
+            while (!scheduler.is_empty())
+                scheduler.dispatch();
+
+            CHECK(mock.get_received_values() == std::vector{1, 2, 3});
+            CHECK(mock.get_on_completed_count() == 1);
+            CHECK(scheduler.get_elided_hops_count() == 0);
+        }
+    }
+    SECTION("subscribe inside run_loop")
+    {
+        scheduler.create_worker().schedule([&](const auto&) -> rpp::schedulers::optional_delay_from_now {
+            rpp::source::just(rpp::schedulers::immediate{}, 1, 2, 3)
+                | rpp::ops::observe_on(scheduler)
+                | rpp::ops::subscribe(mock);
+
+            SECTION("values obtained inline")
+            {
+                CHECK(mock.get_received_values() == std::vector{1, 2, 3});
+                CHECK(mock.get_on_completed_count() == 1);
+            }
+            return {};
+        },
+                                           mock.get_observer().as_dynamic());
+
+        scheduler.dispatch();
+
+        CHECK(scheduler.is_empty());
+        CHECK(mock.get_received_values() == std::vector{1, 2, 3});
+        CHECK(scheduler.get_elided_hops_count() == 4);
+    }
+    SECTION("subscribe inside run_loop with long chain of observe_on")
+    {
+        scheduler.create_worker().schedule([&](const auto&) -> rpp::schedulers::optional_delay_from_now {
+            std::vector<rpp::dynamic_observable<int>> chain{};
+            chain.push_back(rpp::source::just(rpp::schedulers::immediate{}, 1, 2, 3).as_dynamic());
+            for (size_t i = 0; i < 2 * rpp::schedulers::run_loop::max_inline_depth; ++i)
+                chain.push_back((chain.back() | rpp::ops::observe_on(scheduler)).as_dynamic());
+            chain.back() | rpp::ops::subscribe(mock);
+
+            SECTION("recursion is bounded, so values are not obtained inline")
+            {
+                CHECK(mock.get_received_values() == std::vector<int>{});
+            }
+            return {};
+        },
+                                           mock.get_observer().as_dynamic());
+
+        while (!scheduler.is_empty())
+            scheduler.dispatch();
+
+        CHECK(mock.get_received_values() == std::vector{1, 2, 3});
+        CHECK(mock.get_on_completed_count() == 1);
+        CHECK(scheduler.get_elided_hops_count() > 0);
+    }
+    SECTION("subscribe inside run_loop with already queued task")
+    {
+        std::vector<int> order{};
+        scheduler.create_worker().schedule([&](const auto&) -> rpp::schedulers::optional_delay_from_now {
+            scheduler.create_worker().schedule([&](const auto&) -> rpp::schedulers::optional_delay_from_now {
+                order.push_back(0);
+                return {};
+            },
+                                               mock.get_observer().as_dynamic());
+
+            rpp::source::just(rpp::schedulers::immediate{}, 1, 2)
+                | rpp::ops::observe_on(scheduler)
+                | rpp::ops::subscribe([&](int v) { order.push_back(v); });
+
+            SECTION("values are not obtained inline to not overtake queued task")
+            {
+                CHECK(order.empty());
+            }
+            return {};
+        },
+                                           mock.get_observer().as_dynamic());
+
+        while (!scheduler.is_empty())
+            scheduler.dispatch();
+
+        CHECK(order == std::vector{0, 1, 2});
+    }
+    SECTION("subscribe inside other shard of run_loop")
+    {
+        auto sharded = rpp::schedulers::run_loop{2};
+        sharded.create_worker().schedule([&](const auto&) -> rpp::schedulers::optional_delay_from_now {
+            rpp::source::just(rpp::schedulers::immediate{}, 1, 2, 3)
+                | rpp::ops::observe_on(sharded)
+                | rpp::ops::subscribe(mock);
+
+            SECTION("values are not obtained inline due to worker is bound to other shard")
+            {
+                CHECK(mock.get_received_values() == std::vector<int>{});
+            }
+            return {};
+        },
+                                         mock.get_observer().as_dynamic());
+
+        while (!sharded.is_empty())
+            sharded.dispatch();
+
+        CHECK(mock.get_received_values() == std::vector{1, 2, 3});
+        CHECK(mock.get_on_completed_count() == 1);
+        CHECK(sharded.get_elided_hops_count() == 0);
+    }
+}
@@ -13,6 +13,8 @@
 #include <rpp/disposables/disposable_wrapper.hpp>
 #include <rpp/disposables/refcount_disposable.hpp>
 
+#include <vector>
+
 namespace
 {
     struct custom_disposable : public rpp::interface_disposable
@@ -369,4 +371,52 @@ TEST_CASE("static_disposable_container works as expected")
             }
         }
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("deep chains of disposables don't overflow stack")
+{
+    constexpr size_t depth = 100'000;
+
+    auto root = rpp::composite_disposable_wrapper::make();
+    auto last = root;
+    for (size_t i = 0; i < depth; ++i)
+    {
+        auto next = rpp::composite_disposable_wrapper::make();
+        last.add(next);
+        last = std::move(next);
+    }
+
+    SECTION("dispose root")
+    {
+        root.dispose();
+        CHECK(root.is_disposed());
+        CHECK(last.is_disposed());
+    }
+
+    SECTION("destroy root without disposing")
+    {
+        const auto weak_last = last.as_weak();
+        last                 = rpp::composite_disposable_wrapper::empty();
+        root                 = rpp::composite_disposable_wrapper::empty();
+        CHECK(weak_last.is_disposed());
+    }
+}
+
+TEST_CASE("nested disposables disposed in depth-first order")
+{
+    std::vector<int> order{};
+
+    auto root   = rpp::composite_disposable_wrapper::make();
+    auto first  = rpp::composite_disposable_wrapper::make();
+    auto second = rpp::composite_disposable_wrapper::make();
+    root.add(first);
+    root.add(second);
+    first.add([&]() noexcept { order.push_back(1); });
+    first.add([&]() noexcept { order.push_back(2); });
+    second.add([&]() noexcept { order.push_back(3); });
+    root.add([&]() noexcept { order.push_back(4); });
+
+    root.dispose();
+
+    CHECK(order == std::vector{1, 2, 3, 4});
+}
@@ -17,12 +17,16 @@
 #include <rpp/schedulers/immediate.hpp>
 #include <rpp/schedulers/new_thread.hpp>
 #include <rpp/sources/interval.hpp>
+#include <rpp/sources/ticker.hpp>
 
 #include "mock_observer.hpp"
 #include "snitch_logging.hpp"
 #include "test_scheduler.hpp"
 
+#include <algorithm>
 #include <chrono>
+#include <future>
+#include <thread>
 
 TEST_CASE("interval emit values with provided interval")
 {
@@ -150,3 +154,109 @@ TEST_CASE("interval emit values with provided interval")
         }
     }
 }
+
+TEST_CASE("ticker shares timer among intervals with the same period")
+{
+    auto       scheduler    = test_scheduler{};
+    auto       ticker       = rpp::source::ticker<test_scheduler>{scheduler};
+    const auto interval     = std::chrono::seconds{2};
+    const auto initial_time = test_scheduler::worker_strategy::now();
+
+    auto first  = mock_observer_strategy<size_t>{};
+    auto second = mock_observer_strategy<size_t>{};
+
+    ticker.interval(interval) | rpp::ops::take(3) | rpp::ops::subscribe(first);
+    scheduler.time_advance(interval / 2);
+    ticker.interval(interval) | rpp::ops::subscribe(second);
+
+    SECTION("first subscriber starts timer, second one joins it")
+    {
+        CHECK(scheduler.get_schedulings() == std::vector{initial_time + interval});
+
+        scheduler.time_advance(interval / 2);
+        CHECK(first.get_received_values() == std::vector<size_t>{0});
+        CHECK(second.get_received_values().empty());
+
+        // second subscriber obtains first value on the first tick after its initial delay
+        scheduler.time_advance(interval);
+        CHECK(first.get_received_values() == std::vector<size_t>{0, 1});
+        CHECK(second.get_received_values() == std::vector<size_t>{0});
+
+        scheduler.time_advance(interval);
+        CHECK(first.get_received_values() == std::vector<size_t>{0, 1, 2});
+        CHECK(first.get_on_completed_count() == 1);
+        CHECK(second.get_received_values() == std::vector<size_t>{0, 1});
+
+        CHECK(scheduler.get_schedulings() == std::vector{initial_time + interval, initial_time + 2 * interval, initial_time + 3 * interval, initial_time + 4 * interval});
+    }
+
+    SECTION("other period has its own timer")
+    {
+        auto other = mock_observer_strategy<size_t>{};
+        ticker.interval(interval / 2) | rpp::ops::subscribe(other);
+
+        scheduler.time_advance(interval / 2);
+        CHECK(other.get_received_values() == std::vector<size_t>{0});
+        CHECK(first.get_received_values() == std::vector<size_t>{0});
+        // both timers are fired and rescheduled with their own periods
+        auto schedulings = scheduler.get_schedulings();
+        std::sort(schedulings.begin(), schedulings.end());
+        CHECK(schedulings == std::vector{initial_time + interval, initial_time + interval, initial_time + interval + interval / 2, initial_time + 2 * interval});
+    }
+}
+
+TEST_CASE("ticker stops timer without subscribers and restarts it")
+{
+    auto       scheduler    = test_scheduler{};
+    auto       ticker       = rpp::source::ticker<test_scheduler>{scheduler};
+    const auto interval     = std::chrono::seconds{1};
+    const auto initial_time = test_scheduler::worker_strategy::now();
+
+    auto first = mock_observer_strategy<size_t>{};
+    ticker.interval(interval) | rpp::ops::take(1) | rpp::ops::subscribe(first);
+
+    scheduler.time_advance(interval);
+    CHECK(first.get_received_values() == std::vector<size_t>{0});
+
+    scheduler.time_advance(interval);
+    scheduler.time_advance(interval);
+    CHECK(scheduler.get_schedulings() == std::vector{initial_time + interval, initial_time + 2 * interval});
+
+    auto second = mock_observer_strategy<size_t>{};
+    ticker.interval(interval) | rpp::ops::take(2) | rpp::ops::subscribe(second);
+    scheduler.time_advance(interval);
+    scheduler.time_advance(interval);
+    CHECK(second.get_received_values() == std::vector<size_t>{0, 1});
+    CHECK(second.get_on_completed_count() == 1);
+}
+
+TEST_CASE("ticker serves intervals with the same period from one thread")
+{
+    auto ticker = rpp::source::ticker<rpp::schedulers::new_thread>{};
+
+    std::promise<std::thread::id> first{};
+    std::promise<std::thread::id> second{};
+
+    ticker.interval(std::chrono::milliseconds{1}) | rpp::ops::take(1) | rpp::ops::subscribe([&](size_t) { first.set_value(std::this_thread::get_id()); });
+    ticker.interval(std::chrono::milliseconds{1}) | rpp::ops::take(1) | rpp::ops::subscribe([&](size_t) { second.set_value(std::this_thread::get_id()); });
+
+    CHECK(first.get_future().get() == second.get_future().get());
+}
+
+TEST_CASE("ticker releases worker of period without subscribers")
+{
+    auto scheduler = rpp::schedulers::new_thread::async_dispose{};
+    auto ticker    = rpp::source::ticker<rpp::schedulers::new_thread::async_dispose>{scheduler};
+
+    std::promise<void> completed{};
+    ticker.interval(std::chrono::milliseconds{1}) | rpp::ops::take(2) | rpp::ops::subscribe([](size_t) {}, [&]() { completed.set_value(); });
+    completed.get_future().wait();
+
+    // group stops on the next tick without subscribers and its thread finishes while ticker is still alive
+    scheduler.wait_all_threads_finished();
+
+    std::promise<void> restarted{};
+    ticker.interval(std::chrono::milliseconds{1}) | rpp::ops::take(1) | rpp::ops::subscribe([](size_t) {}, [&]() { restarted.set_value(); });
+    restarted.get_future().wait();
+    scheduler.wait_all_threads_finished();
+}
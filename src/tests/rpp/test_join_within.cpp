@@ -0,0 +1,182 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#include <snitch/snitch.hpp>
+
+#include <rpp/operators/join_within.hpp>
+#include <rpp/sources/never.hpp>
+#include <rpp/subjects/publish_subject.hpp>
+
+#include "disposable_observable.hpp"
+#include "mock_observer.hpp"
+#include "snitch_logging.hpp"
+#include "test_scheduler.hpp"
+
+namespace
+{
+    struct order
+    {
+        int id;
+        int price;
+    };
+
+    struct fill
+    {
+        int order_id;
+        int amount;
+    };
+
+    const auto order_id      = [](const order& o) { return o.id; };
+    const auto fill_order_id = [](const fill& f) { return f.order_id; };
+    const auto total         = [](const order& o, const fill& f) { return o.price * f.amount; };
+} // namespace
+
+TEST_CASE("join_within joins values with same key arrived within window")
+{
+    auto scheduler = test_scheduler{};
+    auto mock      = mock_observer_strategy<int>{};
+    auto orders    = rpp::subjects::publish_subject<order>{};
+    auto fills     = rpp::subjects::publish_subject<fill>{};
+
+    orders.get_observable()
+        | rpp::ops::join_within(fills.get_observable(), order_id, fill_order_id, std::chrono::seconds{5}, total, scheduler)
+        | rpp::ops::subscribe(mock);
+
+    SECTION("values with same key are joined regardless of side arrived first")
+    {
+        orders.get_observer().on_next(order{1, 10});
+        fills.get_observer().on_next(fill{1, 2});
+        fills.get_observer().on_next(fill{2, 3});
+        orders.get_observer().on_next(order{2, 100});
+
+        CHECK(mock.get_received_values() == std::vector{20, 300});
+    }
+
+    SECTION("each value joined with all matched values of other side")
+    {
+        orders.get_observer().on_next(order{1, 10});
+        orders.get_observer().on_next(order{1, 20});
+        fills.get_observer().on_next(fill{1, 1});
+        fills.get_observer().on_next(fill{1, 2});
+
+        CHECK(mock.get_received_values() == std::vector{10, 20, 20, 40});
+    }
+
+    SECTION("values with different keys are not joined")
+    {
+        orders.get_observer().on_next(order{1, 10});
+        fills.get_observer().on_next(fill{2, 1});
+
+        CHECK(mock.get_received_values().empty());
+    }
+
+    SECTION("values arrived out of window are not joined")
+    {
+        orders.get_observer().on_next(order{1, 10});
+        scheduler.time_advance(std::chrono::seconds{5});
+        fills.get_observer().on_next(fill{1, 1});
+
+        CHECK(mock.get_received_values().empty());
+
+        SECTION("expiration is scheduled only while there are stored values")
+        {
+            scheduler.time_advance(std::chrono::seconds{5});
+            const auto executions = scheduler.get_executions().size();
+            scheduler.time_advance(std::chrono::seconds{5});
+
+            CHECK(scheduler.get_executions().size() == executions);
+        }
+    }
+
+    SECTION("values arrived within window are joined")
+    {
+        orders.get_observer().on_next(order{1, 10});
+        scheduler.time_advance(std::chrono::seconds{4});
+        fills.get_observer().on_next(fill{1, 1});
+
+        CHECK(mock.get_received_values() == std::vector{10});
+    }
+
+    SECTION("completes only when both observables completed")
+    {
+        orders.get_observer().on_next(order{1, 10});
+        orders.get_observer().on_completed();
+        CHECK(mock.get_on_completed_count() == 0);
+
+        fills.get_observer().on_next(fill{1, 1});
+        fills.get_observer().on_completed();
+
+        CHECK(mock.get_received_values() == std::vector{10});
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SECTION("error from any observable is forwarded")
+    {
+        fills.get_observer().on_error({});
+
+        CHECK(mock.get_on_error_count() == 1);
+    }
+}
+
+TEST_CASE("join_within keeps no more than max_size_per_side values")
+{
+    auto scheduler = test_scheduler{};
+    auto mock      = mock_observer_strategy<int>{};
+    auto orders    = rpp::subjects::publish_subject<order>{};
+    auto fills     = rpp::subjects::publish_subject<fill>{};
+
+    orders.get_observable()
+        | rpp::ops::join_within(fills.get_observable(), order_id, fill_order_id, std::chrono::seconds{5}, total, scheduler, 2)
+        | rpp::ops::subscribe(mock);
+
+    orders.get_observer().on_next(order{1, 1});
+    orders.get_observer().on_next(order{1, 2});
+    orders.get_observer().on_next(order{1, 3});
+    fills.get_observer().on_next(fill{1, 1});
+
+    CHECK(mock.get_received_values() == std::vector{2, 3});
+}
+
+TEST_CASE("join_within doesn't call observer under lock")
+{
+    auto scheduler = test_scheduler{};
+    auto mock      = mock_observer_strategy<int>{};
+    auto orders    = rpp::subjects::publish_subject<order>{};
+    auto fills     = rpp::subjects::publish_subject<fill>{};
+
+    const auto observer = mock.get_observer();
+    orders.get_observable()
+        | rpp::ops::join_within(fills.get_observable(), order_id, fill_order_id, std::chrono::seconds{5}, total, scheduler)
+        | rpp::ops::subscribe([&](int v) {
+              observer.on_next(v);
+              // observer re-enters operator: new match is emitted after current emission
+              if (v == 10)
+              {
+                  fills.get_observer().on_next(fill{1, 2});
+                  CHECK(mock.get_received_values() == std::vector{10});
+                  orders.get_observer().on_completed();
+                  fills.get_observer().on_completed();
+                  CHECK(mock.get_on_completed_count() == 0);
+              }
+          },
+                                [&](const std::exception_ptr& err) { observer.on_error(err); },
+                                [&]() { observer.on_completed(); });
+
+    orders.get_observer().on_next(order{1, 10});
+    fills.get_observer().on_next(fill{1, 1});
+
+    CHECK(mock.get_received_values() == std::vector{10, 20});
+    CHECK(mock.get_on_completed_count() == 1);
+}
+
+TEST_CASE("join_within satisfies disposable contracts")
+{
+    test_operator_with_disposable<order>(rpp::ops::join_within(rpp::source::never<fill>(), order_id, fill_order_id, std::chrono::seconds{5}, total, test_scheduler{}));
+}
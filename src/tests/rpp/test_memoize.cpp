@@ -0,0 +1,176 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#include <snitch/snitch.hpp>
+
+#include <rpp/operators/memoize.hpp>
+#include <rpp/sources/just.hpp>
+#include <rpp/subjects/publish_subject.hpp>
+
+#include "disposable_observable.hpp"
+#include "mock_observer.hpp"
+
+#include <map>
+#include <string>
+#include <thread>
+
+TEST_CASE("memoize shares single subscription per key among concurrent requests")
+{
+    std::map<int, rpp::subjects::publish_subject<int>> lookups{};
+    size_t                                             subscriptions{};
+
+    auto memoized = rpp::ops::memoize(
+        std::identity{},
+        [&](int key) {
+            ++subscriptions;
+            return lookups[key].get_observable();
+        },
+        2,
+        std::chrono::hours{1});
+
+    auto requests = rpp::subjects::publish_subject<int>{};
+    auto mock_1   = mock_observer_strategy<int>{};
+    auto mock_2   = mock_observer_strategy<int>{};
+    requests.get_observable() | memoized | rpp::ops::subscribe(mock_1);
+    requests.get_observable() | memoized | rpp::ops::subscribe(mock_2);
+
+    requests.get_observer().on_next(1);
+    requests.get_observer().on_next(1);
+
+    SECTION("only one subscription for in-flight key and no results till completion")
+    {
+        CHECK(subscriptions == 1);
+        CHECK(mock_1.get_total_on_next_count() == 0);
+
+        lookups[1].get_observer().on_next(10);
+        CHECK(mock_1.get_total_on_next_count() == 0);
+
+        lookups[1].get_observer().on_completed();
+        CHECK(mock_1.get_received_values() == std::vector{10, 10});
+        CHECK(mock_2.get_received_values() == std::vector{10, 10});
+
+        SECTION("completed result is cached")
+        {
+            requests.get_observer().on_next(1);
+
+            CHECK(subscriptions == 1);
+            CHECK(mock_1.get_received_values() == std::vector{10, 10, 10});
+        }
+
+        SECTION("least recently used key is evicted")
+        {
+            requests.get_observer().on_next(2);
+            requests.get_observer().on_next(3);
+            requests.get_observer().on_next(1);
+
+            CHECK(subscriptions == 4);
+        }
+    }
+
+    SECTION("different keys are requested independently")
+    {
+        requests.get_observer().on_next(2);
+        CHECK(subscriptions == 2);
+
+        lookups[2].get_observer().on_next(20);
+        lookups[2].get_observer().on_completed();
+        CHECK(mock_1.get_received_values() == std::vector{20});
+    }
+
+    SECTION("failed result is forwarded to all requesters but not cached")
+    {
+        auto mock_3 = mock_observer_strategy<int>{};
+        rpp::source::just(1) | memoized | rpp::ops::subscribe(mock_3);
+        CHECK(subscriptions == 1);
+
+        lookups[1].get_observer().on_error({});
+        CHECK(mock_1.get_on_error_count() == 1);
+        CHECK(mock_2.get_on_error_count() == 1);
+        CHECK(mock_3.get_on_error_count() == 1);
+
+        auto mock_4 = mock_observer_strategy<int>{};
+        rpp::source::just(1) | memoized | rpp::ops::subscribe(mock_4);
+        CHECK(subscriptions == 2);
+    }
+}
+
+TEST_CASE("memoize doesn't reuse result after ttl")
+{
+    size_t subscriptions{};
+    auto   memoized = rpp::ops::memoize(
+        std::identity{},
+        [&](int key) {
+            ++subscriptions;
+            return rpp::source::just(key);
+        },
+        16,
+        std::chrono::nanoseconds{0});
+
+    auto mock = mock_observer_strategy<int>{};
+    rpp::source::just(1, 1) | memoized | rpp::ops::subscribe(mock);
+
+    CHECK(mock.get_received_values() == std::vector{1, 1});
+    CHECK(subscriptions == 2);
+}
+
+TEST_CASE("memoize handles concurrent requests from different threads")
+{
+    std::atomic_size_t subscriptions{};
+    auto               memoized = rpp::ops::memoize(
+        [](int v) { return v % 8; },
+        [&](int key) {
+            ++subscriptions;
+            return rpp::source::just(key);
+        },
+        16,
+        std::chrono::hours{1});
+
+    std::atomic_size_t       received{};
+    std::vector<std::thread> threads{};
+    for (size_t i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([&] {
+            for (int v = 0; v < 1000; ++v)
+                rpp::source::just(v) | memoized | rpp::ops::subscribe([&](int) { ++received; });
+        });
+    }
+    for (auto& t : threads)
+        t.join();
+
+    CHECK(received.load() == 4000);
+    CHECK(subscriptions.load() == 8);
+}
+
+TEST_CASE("memoize with generic functions keeps separate cache per type")
+{
+    size_t subscriptions{};
+    auto   memoized = rpp::ops::memoize(
+        [](const auto& v) { return v; },
+        [&](const auto& v) {
+            ++subscriptions;
+            return rpp::source::just(v);
+        },
+        2,
+        std::chrono::hours{1});
+
+    auto ints    = mock_observer_strategy<int>{};
+    auto strings = mock_observer_strategy<std::string>{};
+    rpp::source::just(1, 2, 1) | memoized | rpp::ops::subscribe(ints);
+    rpp::source::just(std::string{"1"}, std::string{"1"}) | memoized | rpp::ops::subscribe(strings);
+
+    CHECK(ints.get_received_values() == std::vector{1, 2, 1});
+    CHECK(strings.get_received_values() == std::vector<std::string>{"1", "1"});
+    CHECK(subscriptions == 3);
+}
+
+TEST_CASE("memoize satisfies disposable contracts")
+{
+    test_operator_with_disposable<int>(rpp::ops::memoize(std::identity{}, [](int v) { return rpp::source::just(v); }, 1, std::chrono::seconds{1}));
+}
@@ -0,0 +1,140 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#include <snitch/snitch.hpp>
+
+#include <rpp/operators/merge_with_priority.hpp>
+#include <rpp/schedulers/immediate.hpp>
+#include <rpp/sources/create.hpp>
+#include <rpp/sources/just.hpp>
+#include <rpp/sources/never.hpp>
+#include <rpp/subjects/publish_subject.hpp>
+
+#include "disposable_observable.hpp"
+#include "mock_observer.hpp"
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <thread>
+
+TEST_CASE("merge_with_priority forwards emissions without contention as is")
+{
+    auto mock = mock_observer_strategy<int>{};
+
+    rpp::source::just(rpp::schedulers::immediate{}, 1, 2)
+        | rpp::ops::merge_with_priority(0, 16, rpp::ops::with_priority(rpp::source::just(rpp::schedulers::immediate{}, 3), 1))
+        | rpp::ops::subscribe(mock);
+
+    CHECK(mock.get_received_values() == std::vector{1, 2, 3});
+    CHECK(mock.get_on_completed_count() == 1);
+}
+
+TEST_CASE("merge_with_priority drains staged emissions from highest priority first")
+{
+    auto mock = mock_observer_strategy<int>{};
+    auto bulk = rpp::subjects::publish_subject<int>{};
+    auto ctrl = rpp::subjects::publish_subject<int>{};
+
+    const auto observer = mock.get_observer();
+    bulk.get_observable()
+        | rpp::ops::merge_with_priority(0, 2, rpp::ops::with_priority(ctrl.get_observable(), 10))
+        | rpp::ops::subscribe([&](int v) {
+              observer.on_next(v);
+              // emissions arrived while observer is busy are staged
+              if (v == 1)
+              {
+                  bulk.get_observer().on_next(2);
+                  bulk.get_observer().on_next(3);
+                  bulk.get_observer().on_next(4);
+                  ctrl.get_observer().on_next(100);
+              }
+          },
+                                [&](const std::exception_ptr& err) { observer.on_error(err); },
+                                [&]() { observer.on_completed(); });
+
+    SECTION("higher priority preempts staged emissions and full queue drops emissions")
+    {
+        bulk.get_observer().on_next(1);
+
+        CHECK(mock.get_received_values() == std::vector{1, 100, 2, 3});
+    }
+
+    SECTION("completes only when all observables completed")
+    {
+        bulk.get_observer().on_completed();
+        CHECK(mock.get_on_completed_count() == 0);
+
+        ctrl.get_observer().on_completed();
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SECTION("error from any observable is forwarded")
+    {
+        ctrl.get_observer().on_error({});
+        CHECK(mock.get_on_error_count() == 1);
+    }
+}
+
+TEST_CASE("merge_with_priority drops emissions arrived after termination")
+{
+    auto mock = mock_observer_strategy<std::shared_ptr<int>>{};
+
+    using disposable_t = rpp::operators::details::merge_with_priority_disposable<decltype(mock.get_observer())>;
+
+    const auto state = rpp::disposable_wrapper_impl<disposable_t>::make(mock.get_observer(), std::vector{0, 1}, size_t{16}).lock();
+
+    state->on_completed();
+    state->on_completed();
+    CHECK(mock.get_on_completed_count() == 1);
+
+    // misbehaving source emits after termination: emission is neither forwarded nor staged
+    const auto value = std::make_shared<int>(1);
+    state->on_next(0, value);
+
+    CHECK(mock.get_received_values().empty());
+    CHECK(value.use_count() == 1);
+}
+
+TEST_CASE("merge_with_priority serializes emissions from different threads")
+{
+    std::optional<rpp::dynamic_observer<int>> bulk_obs{};
+    std::optional<rpp::dynamic_observer<int>> ctrl_obs{};
+
+    const auto bulk = rpp::source::create<int>([&](auto&& obs) { bulk_obs.emplace(std::forward<decltype(obs)>(obs).as_dynamic()); });
+    const auto ctrl = rpp::source::create<int>([&](auto&& obs) { ctrl_obs.emplace(std::forward<decltype(obs)>(obs).as_dynamic()); });
+
+    std::atomic_int concurrent{};
+    std::atomic_int max_concurrent{};
+    bulk
+        | rpp::ops::merge_with_priority(0, 1024, rpp::ops::with_priority(ctrl, 1))
+        | rpp::ops::subscribe([&](int) {
+              max_concurrent = std::max(max_concurrent.load(), ++concurrent);
+              --concurrent;
+          });
+
+    REQUIRE(bulk_obs.has_value());
+    REQUIRE(ctrl_obs.has_value());
+
+    std::thread t{[ctrl_obs] {
+        for (int i = 0; i < 1000; ++i)
+            ctrl_obs->on_next(i);
+    }};
+    for (int i = 0; i < 1000; ++i)
+        bulk_obs->on_next(i);
+    t.join();
+
+    CHECK(max_concurrent.load() == 1);
+}
+
+TEST_CASE("merge_with_priority satisfies disposable contracts")
+{
+    test_operator_with_disposable<int>(rpp::ops::merge_with_priority(0, 1, rpp::ops::with_priority(rpp::source::never<int>(), 1)));
+}
@@ -0,0 +1,236 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#include <snitch/snitch.hpp>
+
+#include <rpp/observables/dynamic_observable.hpp>
+#include <rpp/operators/as_blocking.hpp>
+#include <rpp/operators/map.hpp>
+#include <rpp/operators/parallel.hpp>
+#include <rpp/operators/subscribe.hpp>
+#include <rpp/schedulers/immediate.hpp>
+#include <rpp/schedulers/new_thread.hpp>
+#include <rpp/schedulers/run_loop.hpp>
+#include <rpp/sources/from.hpp>
+#include <rpp/sources/just.hpp>
+#include <rpp/subjects/publish_subject.hpp>
+
+#include "mock_observer.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <numeric>
+#include <set>
+#include <thread>
+
+TEST_CASE("parallel emits rails with indexes as keys before any emission")
+{
+    auto subj = rpp::subjects::publish_subject<int>{};
+
+    std::vector<size_t> keys{};
+    subj.get_observable()
+        | rpp::ops::parallel(3, rpp::schedulers::immediate{})
+        | rpp::ops::subscribe([&](const auto& rail) { keys.push_back(rail.get_key()); });
+
+    CHECK(keys == std::vector<size_t>{0, 1, 2});
+}
+
+TEST_CASE("parallel distributes emissions among rails")
+{
+    std::vector<std::vector<int>> rails(3);
+    auto                          mock = mock_observer_strategy<int>{};
+
+    SECTION("round-robin")
+    {
+        rpp::source::just(rpp::schedulers::immediate{}, 1, 2, 3, 4, 5, 6, 7)
+            | rpp::ops::parallel(3, rpp::schedulers::immediate{})
+            | rpp::ops::subscribe([&](const auto& rail) {
+                  rail.subscribe([&rails, key = rail.get_key()](int v) { rails[key].push_back(v); }, [&] { mock.on_completed(); });
+              });
+
+        CHECK(rails == std::vector<std::vector<int>>{{1, 4, 7}, {2, 5}, {3, 6}});
+        CHECK(mock.get_on_completed_count() == 3);
+    }
+
+    SECTION("by key")
+    {
+        rpp::source::just(rpp::schedulers::immediate{}, 1, 2, 3, 4, 5, 6, 7)
+            | rpp::ops::parallel(3, rpp::schedulers::immediate{}, [](int v) { return v % 2; })
+            | rpp::ops::subscribe([&](const auto& rail) {
+                  rail.subscribe([&rails, key = rail.get_key()](int v) { rails[key].push_back(v); });
+              });
+
+        size_t total{};
+        for (const auto& rail : rails)
+        {
+            total += rail.size();
+            for (int v : rail)
+                CHECK(v % 2 == rail.front() % 2);
+        }
+        CHECK(total == 7);
+    }
+}
+
+TEST_CASE("parallel keeps emissions till subscription to rail")
+{
+    auto                                      subj = rpp::subjects::publish_subject<int>{};
+    std::vector<rpp::dynamic_observable<int>> rails{};
+
+    subj.get_observable()
+        | rpp::ops::parallel(2, rpp::schedulers::immediate{})
+        | rpp::ops::subscribe([&](const auto& rail) { rails.push_back(rail.as_dynamic()); }, [](const std::exception_ptr&) {});
+
+    subj.get_observer().on_next(1);
+    subj.get_observer().on_next(2);
+    subj.get_observer().on_next(3);
+
+    auto mock = mock_observer_strategy<int>{};
+    rails[0].subscribe(mock);
+    CHECK(mock.get_received_values() == std::vector{1, 3});
+
+    subj.get_observer().on_next(4);
+    subj.get_observer().on_next(5);
+    CHECK(mock.get_received_values() == std::vector{1, 3, 5});
+
+    SECTION("rail can be subscribed only once")
+    {
+        auto other = mock_observer_strategy<int>{};
+        rails[0].subscribe(other);
+        CHECK(other.get_on_error_count() == 1);
+        CHECK(other.get_received_values().empty());
+    }
+
+    SECTION("terminal event is forwarded to all rails")
+    {
+        auto second = mock_observer_strategy<int>{};
+        rails[1].subscribe(second);
+        CHECK(second.get_received_values() == std::vector{2, 4});
+
+        subj.get_observer().on_error(std::make_exception_ptr(std::runtime_error{""}));
+        CHECK(mock.get_on_error_count() == 1);
+        CHECK(second.get_on_error_count() == 1);
+    }
+}
+
+TEST_CASE("parallel emits rails via their workers")
+{
+    rpp::schedulers::run_loop loop{};
+    auto                      mock = mock_observer_strategy<int>{};
+
+    rpp::source::just(rpp::schedulers::immediate{}, 1, 2, 3, 4)
+        | rpp::ops::parallel(2, loop)
+        | rpp::ops::map([](const auto& rail) { return rail | rpp::ops::map([](int v) { return v * 10; }); })
+        | rpp::ops::sequential_ordered()
+        | rpp::ops::subscribe(mock);
+
+    CHECK(mock.get_received_values().empty());
+
+    // worker is scheduled once per idle-to-busy transition, not once per emission: first rail drains everything at once, but emissions are staged till turn of second rail
+    loop.dispatch();
+    CHECK(mock.get_received_values() == std::vector{10});
+    CHECK(mock.get_on_completed_count() == 0);
+
+    loop.dispatch();
+    CHECK(mock.get_received_values() == std::vector{10, 20, 30, 40});
+    CHECK(mock.get_on_completed_count() == 1);
+    CHECK(loop.is_empty());
+}
+
+TEST_CASE("sequential_ordered restores order of round-robin rails")
+{
+    auto mock = mock_observer_strategy<int>{};
+    auto a    = rpp::subjects::publish_subject<int>{};
+    auto b    = rpp::subjects::publish_subject<int>{};
+
+    rpp::source::just(rpp::schedulers::immediate{}, a.get_observable(), b.get_observable())
+        | rpp::ops::sequential_ordered()
+        | rpp::ops::subscribe(mock);
+
+    b.get_observer().on_next(2);
+    b.get_observer().on_next(4);
+    CHECK(mock.get_received_values().empty());
+
+    a.get_observer().on_next(1);
+    CHECK(mock.get_received_values() == std::vector{1, 2});
+
+    a.get_observer().on_next(3);
+    CHECK(mock.get_received_values() == std::vector{1, 2, 3, 4});
+
+    SECTION("completed rails are skipped")
+    {
+        a.get_observer().on_completed();
+        b.get_observer().on_next(6);
+        CHECK(mock.get_received_values() == std::vector{1, 2, 3, 4, 6});
+        CHECK(mock.get_on_completed_count() == 0);
+
+        b.get_observer().on_completed();
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SECTION("on_error is forwarded immediately")
+    {
+        b.get_observer().on_next(6);
+        a.get_observer().on_error({});
+        CHECK(mock.get_received_values() == std::vector{1, 2, 3, 4});
+        CHECK(mock.get_on_error_count() == 1);
+    }
+}
+
+TEST_CASE("parallel processes rails concurrently on new_thread")
+{
+    constexpr int count = 10000;
+
+    std::vector<int> values(count);
+    std::iota(values.begin(), values.end(), 0);
+
+    std::mutex                mutex{};
+    std::set<std::thread::id> threads{};
+    const auto                main_thread = std::this_thread::get_id();
+    const auto                rails       = rpp::source::from_iterable(values, rpp::schedulers::immediate{})
+                       | rpp::ops::parallel(4, rpp::schedulers::new_thread{})
+                       | rpp::ops::map([&](const auto& rail) {
+                             return rail | rpp::ops::map([&](int v) {
+                                        {
+                                            std::lock_guard lock{mutex};
+                                            threads.insert(std::this_thread::get_id());
+                                        }
+                                        return v * 2;
+                                    });
+                         });
+
+    SECTION("sequential_ordered")
+    {
+        auto mock = mock_observer_strategy<int>{};
+        rails | rpp::ops::sequential_ordered() | rpp::ops::as_blocking() | rpp::ops::subscribe(mock);
+
+        std::vector<int> expected{};
+        for (int v : values)
+            expected.push_back(v * 2);
+
+        CHECK(mock.get_received_values() == expected);
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SECTION("sequential")
+    {
+        auto mock = mock_observer_strategy<int>{};
+        rails | rpp::ops::sequential() | rpp::ops::as_blocking() | rpp::ops::subscribe(mock);
+
+        auto received = mock.get_received_values();
+        std::sort(received.begin(), received.end());
+        CHECK(received.size() == count);
+        CHECK(received.back() == (count - 1) * 2);
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    std::lock_guard lock{mutex};
+    CHECK(threads.size() == 4);
+    CHECK(!threads.contains(main_thread));
+}
@@ -0,0 +1,157 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#include <snitch/snitch.hpp>
+
+#include <rpp/operators/rate_limit.hpp>
+#include <rpp/subjects/publish_subject.hpp>
+
+#include "disposable_observable.hpp"
+#include "mock_observer.hpp"
+#include "test_scheduler.hpp"
+
+TEST_CASE("rate_limit with drop policy drops emissions exceeding rate")
+{
+    test_scheduler scheduler{};
+    auto           mock = mock_observer_strategy<int>{};
+    auto           subj = rpp::subjects::publish_subject<int>{};
+
+    subj.get_observable() | rpp::ops::rate_limit(std::chrono::seconds{1}, 2, scheduler, rpp::ops::rate_limit_policy::drop{}) | rpp::ops::subscribe(mock);
+
+    SECTION("burst of emissions passes at once")
+    {
+        subj.get_observer().on_next(1);
+        subj.get_observer().on_next(2);
+        subj.get_observer().on_next(3);
+
+        CHECK(mock.get_received_values() == std::vector{1, 2});
+
+        SECTION("tokens are refilled with time")
+        {
+            scheduler.time_advance(std::chrono::seconds{1});
+            subj.get_observer().on_next(4);
+            subj.get_observer().on_next(5);
+
+            CHECK(mock.get_received_values() == std::vector{1, 2, 4});
+        }
+
+        SECTION("tokens are not accumulated above burst")
+        {
+            scheduler.time_advance(std::chrono::seconds{10});
+            for (int i = 4; i < 8; ++i)
+                subj.get_observer().on_next(i);
+
+            CHECK(mock.get_received_values() == std::vector{1, 2, 4, 5});
+        }
+    }
+
+    SECTION("emissions within rate are not affected and scheduler is not used")
+    {
+        for (int i = 0; i < 3; ++i)
+        {
+            subj.get_observer().on_next(i);
+            scheduler.time_advance(std::chrono::seconds{1});
+        }
+        subj.get_observer().on_completed();
+
+        CHECK(mock.get_received_values() == std::vector{0, 1, 2});
+        CHECK(mock.get_on_completed_count() == 1);
+        CHECK(scheduler.get_schedulings().empty());
+    }
+
+    SECTION("on_error forwarded")
+    {
+        subj.get_observer().on_error({});
+
+        CHECK(mock.get_on_error_count() == 1);
+    }
+}
+
+TEST_CASE("rate_limit with delay policy delays emissions exceeding rate")
+{
+    test_scheduler scheduler{};
+    auto           start = s_current_time;
+    auto           mock  = mock_observer_strategy<int>{};
+    auto           subj  = rpp::subjects::publish_subject<int>{};
+
+    subj.get_observable() | rpp::ops::rate_limit(std::chrono::seconds{1}, 2, scheduler, rpp::ops::rate_limit_policy::delay{2}) | rpp::ops::subscribe(mock);
+
+    SECTION("emissions within budget are emitted immediately without scheduling")
+    {
+        subj.get_observer().on_next(1);
+        subj.get_observer().on_next(2);
+
+        CHECK(mock.get_received_values() == std::vector{1, 2});
+        CHECK(scheduler.get_schedulings().empty());
+    }
+
+    SECTION("emissions exceeding budget are queued and emitted when tokens are available")
+    {
+        for (int i = 1; i < 5; ++i)
+            subj.get_observer().on_next(i);
+
+        CHECK(mock.get_received_values() == std::vector{1, 2});
+        CHECK(scheduler.get_schedulings() == std::vector{start + std::chrono::seconds{1}});
+
+        scheduler.time_advance(std::chrono::seconds{1});
+        CHECK(mock.get_received_values() == std::vector{1, 2, 3});
+
+        scheduler.time_advance(std::chrono::seconds{1});
+        CHECK(mock.get_received_values() == std::vector{1, 2, 3, 4});
+
+        SECTION("new emission is queued while queue is drained")
+        {
+            subj.get_observer().on_next(5);
+            CHECK(mock.get_received_values() == std::vector{1, 2, 3, 4});
+
+            scheduler.time_advance(std::chrono::seconds{1});
+            CHECK(mock.get_received_values() == std::vector{1, 2, 3, 4, 5});
+        }
+    }
+
+    SECTION("emissions arrived when queue is full are dropped")
+    {
+        for (int i = 1; i < 7; ++i)
+            subj.get_observer().on_next(i);
+
+        scheduler.time_advance(std::chrono::seconds{10});
+        CHECK(mock.get_received_values() == std::vector{1, 2, 3, 4});
+    }
+
+    SECTION("on_completed forwarded after queued emissions")
+    {
+        for (int i = 1; i < 4; ++i)
+            subj.get_observer().on_next(i);
+        subj.get_observer().on_completed();
+
+        CHECK(mock.get_on_completed_count() == 0);
+
+        scheduler.time_advance(std::chrono::seconds{1});
+        CHECK(mock.get_received_values() == std::vector{1, 2, 3});
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SECTION("on_error forwarded and cancels queued emissions")
+    {
+        for (int i = 1; i < 4; ++i)
+            subj.get_observer().on_next(i);
+        subj.get_observer().on_error({});
+
+        scheduler.time_advance(std::chrono::seconds{1});
+        CHECK(mock.get_received_values() == std::vector{1, 2});
+        CHECK(mock.get_on_error_count() == 1);
+    }
+}
+
+TEST_CASE("rate_limit satisfies disposable contracts")
+{
+    test_operator_with_disposable<int>(rpp::ops::rate_limit(std::chrono::seconds{1}, 1, test_scheduler{}, rpp::ops::rate_limit_policy::drop{}));
+    test_operator_with_disposable<int>(rpp::ops::rate_limit(std::chrono::seconds{1}, 1, test_scheduler{}, rpp::ops::rate_limit_policy::delay{1}));
+}
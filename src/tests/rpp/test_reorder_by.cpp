@@ -0,0 +1,109 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#include <snitch/snitch.hpp>
+
+#include <rpp/operators/reorder_by.hpp>
+#include <rpp/sources/just.hpp>
+#include <rpp/subjects/publish_subject.hpp>
+
+#include "disposable_observable.hpp"
+#include "mock_observer.hpp"
+#include "snitch_logging.hpp"
+#include "test_scheduler.hpp"
+
+namespace
+{
+    const auto as_time = [](int v) { return rpp::schedulers::time_point{std::chrono::seconds{v}}; };
+} // namespace
+
+TEST_CASE("reorder_by emits values ordered by timestamp")
+{
+    auto scheduler = test_scheduler{};
+    auto mock      = mock_observer_strategy<int>{};
+    auto stats     = std::make_shared<rpp::operators::reorder_stats>();
+
+    SECTION("just(1,3,2,5,4,8) with lateness 2")
+    {
+        rpp::source::just(1, 3, 2, 5, 4, 8) | rpp::ops::reorder_by(as_time, std::chrono::seconds{2}, scheduler, stats) | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_received_values() == std::vector{1, 2, 3, 4, 5, 8});
+        CHECK(mock.get_on_completed_count() == 1);
+        CHECK(stats->late == 2);
+        CHECK(stats->dropped == 0);
+    }
+
+    SECTION("subject as source")
+    {
+        auto subj = rpp::subjects::publish_subject<int>{};
+        subj.get_observable() | rpp::ops::reorder_by(as_time, std::chrono::seconds{2}, scheduler, stats) | rpp::ops::subscribe(mock);
+
+        subj.get_observer().on_next(1);
+        subj.get_observer().on_next(3);
+        subj.get_observer().on_next(2);
+
+        SECTION("values released once watermark passes them")
+        {
+            CHECK(mock.get_received_values() == std::vector{1});
+
+            subj.get_observer().on_next(5);
+            CHECK(mock.get_received_values() == std::vector{1, 2, 3});
+        }
+
+        SECTION("values behind watermark are dropped")
+        {
+            subj.get_observer().on_next(6);
+            subj.get_observer().on_next(3);
+            subj.get_observer().on_next(4);
+            subj.get_observer().on_completed();
+
+            CHECK(mock.get_received_values() == std::vector{1, 2, 3, 4, 6});
+            CHECK(stats->late == 2);
+            CHECK(stats->dropped == 1);
+        }
+
+        SECTION("all values released if no new values during lateness")
+        {
+            scheduler.time_advance(std::chrono::seconds{1});
+            CHECK(mock.get_received_values() == std::vector{1});
+
+            subj.get_observer().on_next(3);
+            scheduler.time_advance(std::chrono::seconds{1});
+            CHECK(mock.get_received_values() == std::vector{1});
+
+            scheduler.time_advance(std::chrono::seconds{1});
+            CHECK(mock.get_received_values() == std::vector{1, 2, 3, 3});
+            CHECK(mock.get_on_completed_count() == 0);
+        }
+
+        SECTION("error drops buffered values")
+        {
+            subj.get_observer().on_error({});
+
+            CHECK(mock.get_received_values() == std::vector{1});
+            CHECK(mock.get_on_error_count() == 1);
+        }
+    }
+
+    SECTION("values with same timestamp keep arrival order")
+    {
+        auto pairs = mock_observer_strategy<std::pair<int, int>>{};
+        rpp::source::just(std::pair{2, 0}, std::pair{1, 1}, std::pair{2, 2}, std::pair{1, 3})
+            | rpp::ops::reorder_by([](const std::pair<int, int>& p) { return as_time(p.first); }, std::chrono::seconds{2}, scheduler)
+            | rpp::ops::subscribe(pairs);
+
+        CHECK(pairs.get_received_values() == std::vector<std::pair<int, int>>{{1, 1}, {1, 3}, {2, 0}, {2, 2}});
+    }
+}
+
+TEST_CASE("reorder_by satisfies disposable contracts")
+{
+    test_operator_with_disposable<int>(rpp::ops::reorder_by(as_time, std::chrono::seconds{2}, test_scheduler{}));
+}
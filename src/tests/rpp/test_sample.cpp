@@ -0,0 +1,89 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#include <snitch/snitch.hpp>
+
+#include <rpp/operators/sample.hpp>
+#include <rpp/subjects/publish_subject.hpp>
+
+#include "disposable_observable.hpp"
+#include "mock_observer.hpp"
+#include "test_scheduler.hpp"
+
+TEST_CASE("sample emits latest emission each period")
+{
+    const auto     period = std::chrono::seconds{2};
+    test_scheduler scheduler{};
+    auto           start = s_current_time;
+    auto           mock  = mock_observer_strategy<int>{};
+    auto           subj  = rpp::subjects::publish_subject<int>{};
+
+    subj.get_observable() | rpp::ops::sample(period, scheduler) | rpp::ops::subscribe(mock);
+
+    SECTION("no emissions - no scheduling")
+    {
+        scheduler.time_advance(period * 3);
+        CHECK(scheduler.get_schedulings().empty());
+    }
+
+    SECTION("latest emission emitted on tick")
+    {
+        subj.get_observer().on_next(1);
+        subj.get_observer().on_next(2);
+
+        CHECK(scheduler.get_schedulings() == std::vector{start + period});
+        CHECK(mock.get_total_on_next_count() == 0);
+
+        scheduler.time_advance(period);
+        CHECK(mock.get_received_values() == std::vector{2});
+
+        SECTION("tick without new emission emits nothing and stops timer")
+        {
+            scheduler.time_advance(period);
+            scheduler.time_advance(period);
+
+            CHECK(mock.get_received_values() == std::vector{2});
+            CHECK(scheduler.get_executions() == std::vector{start + period, start + period * 2});
+        }
+
+        SECTION("ticks are aligned to subscription time")
+        {
+            scheduler.time_advance(period * 2 + period / 2);
+            subj.get_observer().on_next(3);
+            CHECK(scheduler.get_schedulings().back() == start + period * 4);
+
+            scheduler.time_advance(period / 2);
+            CHECK(mock.get_received_values() == std::vector{2, 3});
+        }
+    }
+
+    SECTION("pending emission emitted on completion")
+    {
+        subj.get_observer().on_next(1);
+        subj.get_observer().on_completed();
+
+        CHECK(mock.get_received_values() == std::vector{1});
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SECTION("on_error forwarded without pending emission")
+    {
+        subj.get_observer().on_next(1);
+        subj.get_observer().on_error({});
+
+        CHECK(mock.get_total_on_next_count() == 0);
+        CHECK(mock.get_on_error_count() == 1);
+    }
+}
+
+TEST_CASE("sample satisfies disposable contracts")
+{
+    test_operator_with_disposable<int>(rpp::ops::sample(std::chrono::seconds{1}, test_scheduler{}));
+}
@@ -0,0 +1,180 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#include <snitch/snitch.hpp>
+
+#include <rpp/operators/scan_by_key.hpp>
+#include <rpp/sources/just.hpp>
+#include <rpp/subjects/publish_subject.hpp>
+#include <rpp/utils/open_addressing_map.hpp>
+
+#include "disposable_observable.hpp"
+#include "mock_observer.hpp"
+#include "snitch_logging.hpp"
+#include "test_scheduler.hpp"
+
+#include <algorithm>
+#include <random>
+#include <unordered_map>
+
+namespace
+{
+    using pair = std::pair<int, int>;
+
+    const auto parity = [](int v) { return v % 2; };
+    const auto sum    = [](int s, int v) { return s + v; };
+
+    std::vector<pair> sorted(std::vector<pair> v)
+    {
+        std::sort(v.begin(), v.end());
+        return v;
+    }
+} // namespace
+
+TEST_CASE("scan_by_key keeps accumulator per key")
+{
+    auto mock = mock_observer_strategy<pair>{};
+
+    SECTION("just(1,2,3,4) with key x%2 emits updated accumulator of key for each emission")
+    {
+        rpp::source::just(1, 2, 3, 4) | rpp::ops::scan_by_key(parity, 0, sum) | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_received_values() == std::vector<pair>{{1, 1}, {0, 2}, {1, 4}, {0, 6}});
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SECTION("accumulator can be any type")
+    {
+        auto strings = mock_observer_strategy<std::pair<int, std::string>>{};
+        rpp::source::just(1, 2, 3) | rpp::ops::scan_by_key(parity, std::string{}, [](std::string&& s, int v) { return std::move(s) + std::to_string(v); }) | rpp::ops::subscribe(strings);
+
+        CHECK(strings.get_received_values() == std::vector<std::pair<int, std::string>>{{1, "1"}, {0, "2"}, {1, "13"}});
+    }
+
+    SECTION("idle key starts from initial value again")
+    {
+        auto subj = rpp::subjects::publish_subject<int>{};
+        subj.get_observable() | rpp::ops::scan_by_key(parity, 0, sum, std::chrono::seconds{1}, test_scheduler{}) | rpp::ops::subscribe(mock);
+
+        subj.get_observer().on_next(1);
+        subj.get_observer().on_next(3);
+        s_current_time += std::chrono::seconds{2};
+        subj.get_observer().on_next(5);
+
+        CHECK(mock.get_received_values() == std::vector<pair>{{1, 1}, {1, 4}, {1, 5}});
+    }
+}
+
+TEST_CASE("reduce_by_key emits final accumulators")
+{
+    auto mock = mock_observer_strategy<pair>{};
+
+    SECTION("just(1,2,3,4) with key x%2 emits accumulator of each key on completion")
+    {
+        rpp::source::just(1, 2, 3, 4) | rpp::ops::reduce_by_key(parity, 0, sum) | rpp::ops::subscribe(mock);
+
+        CHECK(sorted(mock.get_received_values()) == std::vector<pair>{{0, 6}, {1, 4}});
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SECTION("nothing emitted on error")
+    {
+        auto subj = rpp::subjects::publish_subject<int>{};
+        subj.get_observable() | rpp::ops::reduce_by_key(parity, 0, sum) | rpp::ops::subscribe(mock);
+
+        subj.get_observer().on_next(1);
+        subj.get_observer().on_error({});
+
+        CHECK(mock.get_received_values().empty());
+        CHECK(mock.get_on_error_count() == 1);
+    }
+
+    SECTION("idle key is emitted and evicted")
+    {
+        auto subj = rpp::subjects::publish_subject<int>{};
+        subj.get_observable() | rpp::ops::reduce_by_key(parity, 0, sum, std::chrono::seconds{1}, test_scheduler{}) | rpp::ops::subscribe(mock);
+
+        subj.get_observer().on_next(1);
+        subj.get_observer().on_next(2);
+        s_current_time += std::chrono::seconds{2};
+        subj.get_observer().on_next(3);
+
+        CHECK(sorted(mock.get_received_values()) == std::vector<pair>{{0, 2}, {1, 1}});
+
+        subj.get_observer().on_completed();
+
+        CHECK(mock.get_received_values().back() == pair{1, 3});
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+}
+
+TEST_CASE("open_addressing_map behaves as std::unordered_map")
+{
+    rpp::utils::open_addressing_map<int, int> map{};
+    std::unordered_map<int, int>              expected{};
+
+    std::mt19937                       gen{42};
+    std::uniform_int_distribution<int> keys{0, 500};
+
+    for (int i = 0; i < 10'000; ++i)
+    {
+        const int key = keys(gen);
+        switch (i % 3)
+        {
+            case 0:
+            case 1:
+            {
+                const auto [value, inserted]        = map.try_emplace(key, i);
+                const auto [itr, expected_inserted] = expected.try_emplace(key, i);
+                CHECK(inserted == expected_inserted);
+                CHECK(*value == itr->second);
+                break;
+            }
+            default:
+                CHECK(map.erase(key) == (expected.erase(key) == 1));
+        }
+        REQUIRE(map.size() == expected.size());
+    }
+
+    SECTION("erase_if removes all matching entries")
+    {
+        const auto erased = map.erase_if([](int key, int) { return key % 3 == 0; });
+        CHECK(erased == std::erase_if(expected, [](const auto& p) { return p.first % 3 == 0; }));
+        CHECK(map.size() == expected.size());
+    }
+
+    SECTION("clear removes all entries and keeps map usable")
+    {
+        map.clear();
+        expected.clear();
+        CHECK(map.empty());
+        CHECK(map.find(0) == nullptr);
+
+        for (int key = 0; key < 100; ++key)
+        {
+            CHECK(map.try_emplace(key, key).second);
+            expected.emplace(key, key);
+        }
+        CHECK(map.size() == expected.size());
+    }
+
+    size_t visited{};
+    map.for_each([&](int key, int value) {
+        ++visited;
+        CHECK(expected.at(key) == value);
+    });
+    CHECK(visited == expected.size());
+}
+
+TEST_CASE("scan_by_key satisfies disposable contracts")
+{
+    test_operator_with_disposable<int>(rpp::ops::scan_by_key(parity, 0, sum));
+    test_operator_with_disposable<int>(rpp::ops::reduce_by_key(parity, 0, sum));
+}
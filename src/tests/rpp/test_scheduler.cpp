@@ -23,6 +23,8 @@
 #include "mock_observer.hpp"
 #include "rpp/disposables/fwd.hpp"
 
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <future>
 #include <optional>
@@ -30,6 +32,7 @@
 #include <stdexcept>
 #include <string>
 #include <thread>
+#include <vector>
 
 using namespace std::string_literals;
 
@@ -752,6 +755,77 @@ TEST_CASE("new_thread works till end")
     CHECK(mock.get_received_values().size() == 10);
 }
 
+TEST_CASE("new_thread::async_dispose doesn't block disposing thread")
+{
+    auto scheduler = rpp::schedulers::new_thread::async_dispose{};
+    auto worker    = scheduler.create_worker();
+    auto mock      = mock_observer_strategy<int>{};
+    auto obs       = mock.get_observer().as_dynamic();
+    obs.set_upstream(worker.get_disposable());
+
+    std::atomic_bool started{};
+    std::atomic_bool can_finish{};
+    std::atomic_bool finished{};
+    worker.schedule([&](const auto&) -> rpp::schedulers::optional_delay_from_now {
+        started = true;
+        while (!can_finish)
+        {
+        };
+        finished = true;
+        return {};
+    },
+                    obs);
+
+    while (!started)
+    {
+    };
+
+    SECTION("dispose returns while schedulable is still executing")
+    {
+        worker.get_disposable().dispose();
+        CHECK(worker.get_disposable().is_disposed());
+        CHECK(!finished);
+
+        can_finish = true;
+        scheduler.wait_all_threads_finished();
+        CHECK(finished);
+    }
+}
+
+TEST_CASE("new_thread::async_dispose waits till threads destroy their thread_local objects")
+{
+    struct thread_local_tracker
+    {
+        std::atomic_bool* destroyed{};
+
+        ~thread_local_tracker()
+        {
+            if (destroyed)
+                destroyed->store(true);
+        }
+    };
+
+    auto scheduler = rpp::schedulers::new_thread::async_dispose{};
+    auto worker    = scheduler.create_worker();
+    auto obs       = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    std::atomic_bool   destroyed{};
+    std::promise<void> executed{};
+    worker.schedule([&](const auto&) -> rpp::schedulers::optional_delay_from_now {
+        thread_local thread_local_tracker tracker{};
+        tracker.destroyed = &destroyed;
+        executed.set_value();
+        return {};
+    },
+                    obs);
+
+    executed.get_future().wait();
+    worker.get_disposable().dispose();
+    scheduler.wait_all_threads_finished();
+
+    CHECK(destroyed.load());
+}
+
 TEST_CASE("run_loop scheduler dispatches tasks only manually")
 {
     auto scheduler = rpp::schedulers::run_loop{};
@@ -859,6 +933,135 @@ TEST_CASE("run_loop scheduler dispatches tasks only manually")
     }
 }
 
+TEST_CASE("run_loop scheduler can be dispatched by multiple threads")
+{
+    constexpr size_t   workers_count    = 8;
+    constexpr size_t   threads_count    = 4;
+    constexpr size_t   tasks_per_worker = 1000;
+    auto               scheduler        = rpp::schedulers::run_loop{threads_count};
+    auto               obs              = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+    std::atomic_size_t executed_count{};
+
+    struct worker_state
+    {
+        std::vector<size_t> executions{};
+        std::atomic_bool    is_executing{};
+        std::atomic_bool    executed_concurrently{};
+    };
+    std::array<worker_state, workers_count> states{};
+
+    for (auto& state : states)
+    {
+        auto worker = scheduler.create_worker();
+        for (size_t i = 0; i < tasks_per_worker; ++i)
+        {
+            worker.schedule([&state, &executed_count, i](const auto&) -> rpp::schedulers::optional_delay_from_now {
+                if (state.is_executing.exchange(true))
+                    state.executed_concurrently = true;
+                state.executions.push_back(i);
+                state.is_executing = false;
+                ++executed_count;
+                return {};
+            },
+                            obs);
+        }
+    }
+
+    std::vector<std::thread> threads{};
+    for (size_t i = 0; i < threads_count; ++i)
+    {
+        threads.emplace_back([&] {
+            while (executed_count < workers_count * tasks_per_worker)
+                scheduler.dispatch_if_ready();
+        });
+    }
+    for (auto& t : threads)
+        t.join();
+
+    CHECK(scheduler.is_empty());
+    for (auto& state : states)
+    {
+        CHECK(!state.executed_concurrently);
+        REQUIRE(state.executions.size() == tasks_per_worker);
+        for (size_t i = 0; i < tasks_per_worker; ++i)
+            CHECK(state.executions[i] == i);
+    }
+}
+
+TEST_CASE("run_loop scheduler wakes up waiting dispatchers")
+{
+    auto scheduler = rpp::schedulers::run_loop{2};
+    auto obs       = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    std::atomic_size_t executed_count{};
+    std::promise<void> started{};
+    std::thread        t{[&] {
+        started.set_value();
+        scheduler.dispatch();
+        scheduler.dispatch();
+    }};
+
+    started.get_future().wait();
+    scheduler.create_worker().schedule([&](const auto&) -> rpp::schedulers::optional_delay_from_now { ++executed_count; return {}; }, obs);
+    scheduler.create_worker().schedule(std::chrono::milliseconds{10}, [&](const auto&) -> rpp::schedulers::optional_delay_from_now { ++executed_count; return {}; }, obs);
+
+    t.join();
+    CHECK(executed_count == 2);
+    CHECK(scheduler.is_empty());
+}
+
+TEST_CASE("run_loop scheduler can be dispatched from its own task")
+{
+    auto scheduler = rpp::schedulers::run_loop{};
+    auto obs       = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    std::vector<int> order{};
+    scheduler.create_worker().schedule([&](const auto&) -> rpp::schedulers::optional_delay_from_now {
+        scheduler.create_worker().schedule([&](const auto&) -> rpp::schedulers::optional_delay_from_now {
+            order.push_back(1);
+            return {};
+        },
+                                           obs);
+
+        scheduler.dispatch();
+        order.push_back(2);
+        return {};
+    },
+                                       obs);
+
+    scheduler.dispatch();
+
+    CHECK(order == std::vector{1, 2});
+    CHECK(scheduler.is_empty());
+
+    SECTION("shard is still owned by outer dispatching after nested one")
+    {
+        bool executed{};
+        bool executed_by_other_thread{};
+        scheduler.create_worker().schedule([&](const auto&) -> rpp::schedulers::optional_delay_from_now {
+            scheduler.create_worker().schedule([](const auto&) -> rpp::schedulers::optional_delay_from_now { return {}; }, obs);
+            scheduler.dispatch();
+
+            scheduler.create_worker().schedule([&](const auto&) -> rpp::schedulers::optional_delay_from_now {
+                executed = true;
+                return {};
+            },
+                                               obs);
+            std::thread{[&] { scheduler.dispatch_if_ready(); }}.join();
+            executed_by_other_thread = executed;
+            return {};
+        },
+                                           obs);
+
+        scheduler.dispatch();
+        CHECK(!executed_by_other_thread);
+
+        scheduler.dispatch();
+        CHECK(executed);
+        CHECK(scheduler.is_empty());
+    }
+}
+
 TEST_CASE("different delaying strategies")
 {
     test_scheduler scheduler{};
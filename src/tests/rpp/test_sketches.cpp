@@ -0,0 +1,150 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#include <snitch/snitch.hpp>
+
+#include <rpp/operators/approx_count_distinct.hpp>
+#include <rpp/operators/flat_map.hpp>
+#include <rpp/operators/quantiles.hpp>
+#include <rpp/operators/top_k.hpp>
+#include <rpp/operators/window.hpp>
+#include <rpp/sources/empty.hpp>
+#include <rpp/sources/from.hpp>
+#include <rpp/sources/just.hpp>
+
+#include "disposable_observable.hpp"
+#include "mock_observer.hpp"
+#include "snitch_logging.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+namespace
+{
+    using counts = std::vector<std::pair<int, size_t>>;
+
+    std::vector<int> shuffled_range(int count)
+    {
+        std::vector<int> values(static_cast<size_t>(count));
+        std::iota(values.begin(), values.end(), 0);
+        std::shuffle(values.begin(), values.end(), std::mt19937{42});
+        return values;
+    }
+} // namespace
+
+TEST_CASE("approx_count_distinct emits approximate amount of distinct values")
+{
+    auto mock = mock_observer_strategy<size_t>{};
+
+    SECTION("small cardinality is counted exactly")
+    {
+        rpp::source::just(1, 2, 1, 3, 2) | rpp::ops::approx_count_distinct() | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_received_values() == std::vector<size_t>{3});
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SECTION("large cardinality is estimated within error bound")
+    {
+        auto values = shuffled_range(100'000);
+        values.insert(values.end(), values.begin(), values.end());
+        rpp::source::from_iterable(values) | rpp::ops::approx_count_distinct(14) | rpp::ops::subscribe(mock);
+
+        REQUIRE(mock.get_received_values().size() == 1);
+        const auto estimate = static_cast<double>(mock.get_received_values().front());
+        CHECK(std::abs(estimate - 100'000) < 100'000 * 0.03);
+    }
+
+    SECTION("can be used as per-window aggregate")
+    {
+        rpp::source::just(1, 1, 2, 3, 3, 3)
+            | rpp::ops::window(3)
+            | rpp::ops::flat_map([](const auto& w) { return w | rpp::ops::approx_count_distinct(); })
+            | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_received_values() == std::vector<size_t>{2, 1});
+    }
+}
+
+TEST_CASE("top_k emits the most frequent values")
+{
+    auto mock = mock_observer_strategy<counts>{};
+
+    SECTION("exact counts while amount of distinct values fits into capacity")
+    {
+        rpp::source::just(1, 2, 1, 3, 1, 2) | rpp::ops::top_k(2) | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_received_values() == std::vector<counts>{{{1, 3}, {2, 2}}});
+    }
+
+    SECTION("heavy hitters are found among many rare values")
+    {
+        std::vector<int> values = shuffled_range(10'000);
+        for (int i = 0; i < 3'000; ++i)
+            values.push_back(-1 - i % 3);
+        std::shuffle(values.begin(), values.end(), std::mt19937{7});
+
+        rpp::source::from_iterable(values) | rpp::ops::top_k(3, 100) | rpp::ops::subscribe(mock);
+
+        REQUIRE(mock.get_received_values().size() == 1);
+        const auto top = mock.get_received_values().front();
+        REQUIRE(top.size() == 3);
+        for (const auto& [value, count] : top)
+        {
+            CHECK(value < 0);
+            CHECK(count >= 1'000);
+        }
+    }
+
+    SECTION("empty observable emits empty vector")
+    {
+        rpp::source::empty<int>() | rpp::ops::top_k(2) | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_received_values() == std::vector<counts>{counts{}});
+    }
+}
+
+TEST_CASE("quantiles emits approximate quantiles")
+{
+    auto mock = mock_observer_strategy<std::vector<int>>{};
+
+    SECTION("exact result while amount of values is less than k")
+    {
+        rpp::source::just(1, 5, 2, 4, 3) | rpp::ops::quantiles({0, 0.5, 1}) | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_received_values() == std::vector<std::vector<int>>{{1, 3, 5}});
+    }
+
+    SECTION("large amount of values is estimated within rank error")
+    {
+        rpp::source::from_iterable(shuffled_range(100'000)) | rpp::ops::quantiles({0.5, 0.99}, 256) | rpp::ops::subscribe(mock);
+
+        REQUIRE(mock.get_received_values().size() == 1);
+        const auto q = mock.get_received_values().front();
+        REQUIRE(q.size() == 2);
+        CHECK(std::abs(q[0] - 50'000) < 2'000);
+        CHECK(std::abs(q[1] - 99'000) < 2'000);
+    }
+
+    SECTION("empty observable emits empty vector")
+    {
+        rpp::source::empty<int>() | rpp::ops::quantiles({0.5}) | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_received_values() == std::vector<std::vector<int>>{std::vector<int>{}});
+    }
+}
+
+TEST_CASE("sketch operators satisfy disposable contracts")
+{
+    test_operator_with_disposable<int>(rpp::ops::approx_count_distinct());
+    test_operator_with_disposable<int>(rpp::ops::top_k(2));
+    test_operator_with_disposable<int>(rpp::ops::quantiles({0.5}));
+}
@@ -13,12 +13,24 @@
 #include <rpp/disposables/composite_disposable.hpp>
 #include <rpp/operators/as_blocking.hpp>
 #include <rpp/sources/create.hpp>
+#include <rpp/schedulers/immediate.hpp>
+#include <rpp/schedulers/new_thread.hpp>
+#include <rpp/schedulers/run_loop.hpp>
+#include <rpp/subjects/broadcast_subject.hpp>
+#include <rpp/subjects/keyed_subject.hpp>
+#include <rpp/subjects/mailbox_subject.hpp>
 #include <rpp/subjects/publish_subject.hpp>
 #include <rpp/subjects/replay_subject.hpp>
 
 #include "copy_count_tracker.hpp"
 #include "mock_observer.hpp"
 
+#include <atomic>
+#include <future>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <string>
 #include <thread>
 
 TEST_CASE("publish subject multicasts values")
@@ -427,4 +439,424 @@ TEMPLATE_TEST_CASE("replay subject doesn't introduce additional copies", "", rpp
             CHECK(tracker.get_move_count() == 0 + 1);                   // + 1 move to this observer
         });
     }
-}
\ No newline at end of file
+}
+TEST_CASE("broadcast subject multicasts values via ring buffer")
+{
+    auto subj = rpp::subjects::broadcast_subject<int, rpp::schedulers::immediate>{4};
+    auto mock = mock_observer_strategy<int>{};
+
+    subj.get_observer().on_next(0);
+    subj.get_observable().subscribe(mock);
+
+    SECTION("each observer obtains only values emitted after subscription")
+    {
+        auto late = mock_observer_strategy<int>{};
+        for (int v = 1; v < 10; ++v)
+        {
+            if (v == 5)
+                subj.get_observable().subscribe(late);
+            subj.get_observer().on_next(v);
+        }
+
+        CHECK(mock.get_received_values() == std::vector{1, 2, 3, 4, 5, 6, 7, 8, 9});
+        CHECK(late.get_received_values() == std::vector{5, 6, 7, 8, 9});
+    }
+
+    SECTION("terminal events are forwarded to current and new observers")
+    {
+        subj.get_observer().on_next(1);
+        subj.get_observer().on_completed();
+        subj.get_observer().on_next(2);
+
+        auto late = mock_observer_strategy<int>{};
+        subj.get_observable().subscribe(late);
+
+        CHECK(mock.get_received_values() == std::vector{1});
+        CHECK(mock.get_on_completed_count() == 1);
+        CHECK(late.get_received_values().empty());
+        CHECK(late.get_on_completed_count() == 1);
+    }
+
+    SECTION("on_error is forwarded")
+    {
+        subj.get_observer().on_error({});
+        CHECK(mock.get_on_error_count() == 1);
+    }
+
+    SECTION("disposing of subject drops observers without terminal events")
+    {
+        subj.get_disposable().dispose();
+        subj.get_observer().on_next(1);
+        CHECK(mock.get_total_on_next_count() == 0);
+        CHECK(mock.get_on_completed_count() == 0);
+    }
+}
+
+TEST_CASE("broadcast subject writes value once and observers read it in place")
+{
+    auto subj = rpp::subjects::broadcast_subject<copy_count_tracker, rpp::schedulers::immediate>{4};
+
+    std::vector<const copy_count_tracker*> addresses{};
+    for (size_t i = 0; i < 3; ++i)
+        subj.get_observable().subscribe([&](const copy_count_tracker& tracker) { addresses.push_back(&tracker); });
+
+    copy_count_tracker tracker{};
+    subj.get_observer().on_next(tracker);
+
+    CHECK(tracker.get_copy_count() == 1); // copy to slot of ring buffer
+    CHECK(tracker.get_move_count() == 0);
+    REQUIRE(addresses.size() == 3);
+    CHECK(addresses[0] == addresses[1]);
+    CHECK(addresses[1] == addresses[2]);
+}
+
+TEST_CASE("broadcast subject serves observers via their workers")
+{
+    rpp::schedulers::run_loop loop{};
+    auto                      subj = rpp::subjects::broadcast_subject<int, rpp::schedulers::run_loop>{4, loop};
+    auto                      mock = mock_observer_strategy<int>{};
+
+    subj.get_observable().subscribe(mock);
+    subj.get_observer().on_next(1);
+    subj.get_observer().on_next(2);
+    subj.get_observer().on_completed();
+    CHECK(mock.get_received_values().empty());
+
+    while (!loop.is_empty())
+        loop.dispatch();
+
+    CHECK(mock.get_received_values() == std::vector{1, 2});
+    CHECK(mock.get_on_completed_count() == 1);
+
+    SECTION("disposed observer doesn't hold producer")
+    {
+        auto other = rpp::subjects::broadcast_subject<int, rpp::schedulers::run_loop>{2, loop};
+        auto d     = rpp::composite_disposable_wrapper::make();
+        other.get_observable().subscribe(d, [](int) {});
+        d.dispose();
+
+        // would wait forever if disposed observer still held slots of ring buffer
+        for (int v = 0; v < 10; ++v)
+            other.get_observer().on_next(v);
+    }
+}
+
+TEMPLATE_TEST_CASE("broadcast subject bounds memory by waiting for the slowest observer", "", rpp::subjects::wait_strategy::busy_spin, rpp::subjects::wait_strategy::yielding, rpp::subjects::wait_strategy::blocking)
+{
+    constexpr int count = 10000;
+
+    auto subj = rpp::subjects::broadcast_subject<int, rpp::schedulers::new_thread, TestType>{8};
+
+    std::vector<std::vector<int>>   received(3);
+    std::vector<std::promise<void>> completed(3);
+    for (size_t i = 0; i < received.size(); ++i)
+        subj.get_observable().subscribe([&received, i](int v) { received[i].push_back(v); }, [&completed, i] { completed[i].set_value(); });
+
+    std::atomic_int    processed_by_slow{};
+    std::atomic_int    max_lag{};
+    std::atomic_int    produced{};
+    std::promise<void> slow_completed{};
+    subj.get_observable().subscribe(
+        [&](int) {
+            std::this_thread::sleep_for(std::chrono::microseconds{1});
+            const auto lag = produced.load() - processed_by_slow.fetch_add(1) - 1;
+            max_lag.store(std::max(max_lag.load(), lag));
+        },
+        [&] { slow_completed.set_value(); });
+
+    for (int v = 0; v < count; ++v)
+    {
+        subj.get_observer().on_next(v);
+        produced.fetch_add(1);
+    }
+    subj.get_observer().on_completed();
+
+    std::vector<int> expected(count);
+    std::iota(expected.begin(), expected.end(), 0);
+    for (size_t i = 0; i < received.size(); ++i)
+    {
+        completed[i].get_future().wait();
+        CHECK(received[i] == expected);
+    }
+    slow_completed.get_future().wait();
+
+    // producer never runs ahead of the slowest observer by more than capacity of ring buffer
+    CHECK(max_lag.load() <= 8);
+}
+
+TEST_CASE("broadcast subject doesn't overwrite slots of observers subscribed during emissions")
+{
+    constexpr int count       = 20000;
+    constexpr int subscribers = 20;
+
+    auto subj = rpp::subjects::broadcast_subject<int, rpp::schedulers::new_thread, rpp::subjects::wait_strategy::yielding>{2};
+
+    // fast observer lets producer run ahead, so, cached cursor of producer is ahead of cursor of newly subscribed observers
+    std::promise<void> fast_completed{};
+    subj.get_observable().subscribe([](int) {}, [&] { fast_completed.set_value(); });
+
+    std::atomic_int                 gaps{};
+    std::vector<std::promise<void>> completed(subscribers);
+    std::thread                     subscriber{[&] {
+        for (size_t i = 0; i < completed.size(); ++i)
+        {
+            auto last = std::make_shared<std::optional<int>>();
+            subj.get_observable().subscribe(
+                [&gaps, last](int v) {
+                    if (last->has_value() && last->value() + 1 != v)
+                        ++gaps;
+                    *last = v;
+                },
+                [&completed, i] { completed[i].set_value(); });
+            std::this_thread::yield();
+        }
+    }};
+
+    for (int v = 0; v < count; ++v)
+        subj.get_observer().on_next(v);
+
+    subscriber.join();
+    subj.get_observer().on_completed();
+
+    fast_completed.get_future().wait();
+    for (auto& c : completed)
+        c.get_future().wait();
+
+    CHECK(gaps.load() == 0);
+}
+
+TEST_CASE("mailbox subject delivers values via mailboxes of observers")
+{
+    rpp::schedulers::run_loop loop{};
+    auto                      subj   = rpp::subjects::mailbox_subject<int, rpp::schedulers::run_loop>{loop};
+    auto                      mock_1 = mock_observer_strategy<int>{};
+    auto                      mock_2 = mock_observer_strategy<int>{};
+
+    subj.get_observable().subscribe(mock_1);
+    subj.get_observable().subscribe(mock_2);
+
+    subj.get_observer().on_next(1);
+    subj.get_observer().on_next(2);
+    subj.get_observer().on_completed();
+    CHECK(mock_1.get_received_values().empty());
+    CHECK(mock_2.get_received_values().empty());
+
+    while (!loop.is_empty())
+        loop.dispatch();
+
+    CHECK(mock_1.get_received_values() == std::vector{1, 2});
+    CHECK(mock_1.get_on_completed_count() == 1);
+    CHECK(mock_2.get_received_values() == std::vector{1, 2});
+    CHECK(mock_2.get_on_completed_count() == 1);
+
+    SECTION("terminal event is delivered to late observer via its mailbox")
+    {
+        auto late = mock_observer_strategy<int>{};
+        subj.get_observable().subscribe(late);
+        CHECK(late.get_on_completed_count() == 0);
+
+        while (!loop.is_empty())
+            loop.dispatch();
+        CHECK(late.get_on_completed_count() == 1);
+    }
+}
+
+TEST_CASE("mailbox subject applies overflow policy of each observer")
+{
+    rpp::schedulers::run_loop loop{};
+    auto                      subj  = rpp::subjects::mailbox_subject<int, rpp::schedulers::run_loop>{loop};
+    auto                      stats = std::make_shared<rpp::subjects::mailbox_stats>();
+    auto                      mock  = mock_observer_strategy<int>{};
+
+    const auto emit_and_dispatch = [&] {
+        const auto observer = subj.get_observer();
+        for (int v = 1; v <= 5; ++v)
+            observer.on_next(v);
+
+        CHECK(stats->lag == 2);
+        CHECK(stats->max_lag == 2);
+
+        while (!loop.is_empty())
+            loop.dispatch();
+
+        CHECK(stats->lag == 0);
+    };
+
+    SECTION("drop oldest")
+    {
+        subj.get_observable({2, rpp::subjects::overflow_policy::drop_oldest, stats}).subscribe(mock);
+        emit_and_dispatch();
+
+        CHECK(mock.get_received_values() == std::vector{4, 5});
+        CHECK(stats->enqueued == 5);
+        CHECK(stats->delivered == 2);
+        CHECK(stats->dropped == 3);
+        CHECK(stats->disconnected == 0);
+    }
+
+    SECTION("drop newest")
+    {
+        subj.get_observable({2, rpp::subjects::overflow_policy::drop_newest, stats}).subscribe(mock);
+        emit_and_dispatch();
+
+        CHECK(mock.get_received_values() == std::vector{1, 2});
+        CHECK(stats->enqueued == 2);
+        CHECK(stats->delivered == 2);
+        CHECK(stats->dropped == 3);
+        CHECK(stats->disconnected == 0);
+    }
+
+    SECTION("disconnect")
+    {
+        auto other = mock_observer_strategy<int>{};
+        subj.get_observable({2, rpp::subjects::overflow_policy::disconnect, stats}).subscribe(mock);
+        subj.get_observable({8}).subscribe(other);
+
+        for (int v = 1; v <= 5; ++v)
+            subj.get_observer().on_next(v);
+
+        CHECK(stats->lag == 0);
+        CHECK(stats->max_lag == 2);
+
+        while (!loop.is_empty())
+            loop.dispatch();
+
+        CHECK(mock.get_received_values().empty());
+        CHECK(mock.get_on_error_count() == 1);
+        CHECK(stats->enqueued == 2);
+        CHECK(stats->delivered == 0);
+        CHECK(stats->dropped == 3);
+        CHECK(stats->disconnected == 1);
+
+        // other observers are not affected
+        CHECK(other.get_received_values() == std::vector{1, 2, 3, 4, 5});
+
+        subj.get_observer().on_next(6);
+        while (!loop.is_empty())
+            loop.dispatch();
+        CHECK(mock.get_received_values().empty());
+        CHECK(other.get_received_values() == std::vector{1, 2, 3, 4, 5, 6});
+    }
+}
+
+TEST_CASE("mailbox subject isolates producer and observers from slow observer")
+{
+    constexpr int count = 1000;
+
+    auto subj  = rpp::subjects::mailbox_subject<int>{rpp::schedulers::new_thread{}, {count}};
+    auto stats = std::make_shared<rpp::subjects::mailbox_stats>();
+
+    std::promise<void> fast_received_all{};
+    auto               fast_received_all_future = fast_received_all.get_future();
+    std::promise<void> emitted_all{};
+    auto               emitted_all_future = emitted_all.get_future();
+    std::promise<void> slow_completed{};
+
+    std::vector<int> fast{};
+    subj.get_observable().subscribe(
+        [&](int v) {
+            fast.push_back(v);
+            if (fast.size() == count)
+                fast_received_all.set_value();
+        },
+        [](const std::exception_ptr&) {});
+
+    std::vector<int> slow{};
+    subj.get_observable({4, rpp::subjects::overflow_policy::drop_newest, stats})
+        .subscribe(
+            [&](int v) {
+                // slow observer is stuck till fast one obtains everything and producer emits everything
+                fast_received_all_future.wait();
+                emitted_all_future.wait();
+                slow.push_back(v);
+            },
+            [](const std::exception_ptr&) {},
+            [&] { slow_completed.set_value(); });
+
+    for (int v = 0; v < count; ++v)
+        subj.get_observer().on_next(v);
+    emitted_all.set_value();
+    subj.get_observer().on_completed();
+
+    slow_completed.get_future().wait();
+
+    std::vector<int> expected(count);
+    std::iota(expected.begin(), expected.end(), 0);
+    CHECK(fast == expected);
+    CHECK(slow.size() <= 5);
+    CHECK(stats->dropped == count - slow.size());
+}
+
+TEST_CASE("keyed subject routes values by key")
+{
+    auto subj  = rpp::subjects::keyed_subject<std::string, int>{};
+    auto a     = mock_observer_strategy<int>{};
+    auto a_2   = mock_observer_strategy<int>{};
+    auto b     = mock_observer_strategy<int>{};
+    auto all   = mock_observer_strategy<int>{};
+    auto d_a_2 = rpp::composite_disposable_wrapper::make();
+
+    subj.get_observable("a").subscribe(a);
+    subj.get_observable("a").subscribe(d_a_2, a_2);
+    subj.get_observable("b").subscribe(b);
+    subj.get_observable().subscribe(all);
+
+    subj.get_observer().on_next({"a", 1});
+    subj.get_observer().on_next({"b", 2});
+    subj.get_observer().on_next({"c", 3});
+
+    CHECK(a.get_received_values() == std::vector{1});
+    CHECK(a_2.get_received_values() == std::vector{1});
+    CHECK(b.get_received_values() == std::vector{2});
+    CHECK(all.get_received_values() == std::vector{1, 2, 3});
+
+    SECTION("disposed observer doesn't affect others of the same key")
+    {
+        d_a_2.dispose();
+        subj.get_observer().on_next({"a", 4});
+
+        CHECK(a.get_received_values() == std::vector{1, 4});
+        CHECK(a_2.get_received_values() == std::vector{1});
+        CHECK(all.get_received_values() == std::vector{1, 2, 3, 4});
+    }
+
+    SECTION("on_error is forwarded to observers of all keys and cached")
+    {
+        subj.get_observer().on_error(std::make_exception_ptr(std::runtime_error{""}));
+        CHECK(a.get_on_error_count() == 1);
+        CHECK(a_2.get_on_error_count() == 1);
+        CHECK(b.get_on_error_count() == 1);
+        CHECK(all.get_on_error_count() == 1);
+
+        auto late = mock_observer_strategy<int>{};
+        subj.get_observable("a").subscribe(late);
+        CHECK(late.get_on_error_count() == 1);
+    }
+
+    SECTION("on_completed is forwarded to observers of all keys and cached")
+    {
+        subj.get_observer().on_completed();
+        CHECK(a.get_on_completed_count() == 1);
+        CHECK(a_2.get_on_completed_count() == 1);
+        CHECK(b.get_on_completed_count() == 1);
+        CHECK(all.get_on_completed_count() == 1);
+
+        auto late = mock_observer_strategy<int>{};
+        subj.get_observable("d").subscribe(late);
+        CHECK(late.get_on_completed_count() == 1);
+    }
+
+    SECTION("disposed subject doesn't forward anything")
+    {
+        subj.get_disposable().dispose();
+        subj.get_observer().on_next({"a", 5});
+
+        auto late = mock_observer_strategy<int>{};
+        subj.get_observable("a").subscribe(late);
+
+        CHECK(a.get_received_values() == std::vector{1});
+        CHECK(a.get_on_completed_count() == 0);
+        CHECK(late.get_total_on_next_count() == 0);
+        CHECK(late.get_on_completed_count() == 0);
+    }
+}
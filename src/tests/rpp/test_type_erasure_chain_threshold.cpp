@@ -0,0 +1,65 @@
+//                   ReactivePlusPlus library
+//
+//           Copyright Aleksey Loginov 2023 - present.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+//
+//  Project home: https://github.com/victimsnino/ReactivePlusPlus
+
+#include <snitch/snitch.hpp>
+
+#include <rpp/observables/dynamic_observable.hpp>
+#include <rpp/operators/filter.hpp>
+#include <rpp/operators/map.hpp>
+#include <rpp/operators/subscribe.hpp>
+#include <rpp/sources/create.hpp>
+
+#include "mock_observer.hpp"
+
+#include <limits>
+#include <string>
+
+namespace
+{
+    template<typename Type, typename Strategy>
+    Strategy strategy_of(const rpp::observable<Type, Strategy>&);
+
+    template<typename TObservable>
+    constexpr size_t chain_length_of = rpp::details::observables::chain_length_v<decltype(strategy_of(std::declval<TObservable>()))>;
+
+    // threshold is applied to whole program via CMake option, so, test checks configured one (this file is also built as separate executable with non-zero threshold). Zero means chain is never type-erased
+    constexpr size_t erasure_period = RPP_TYPE_ERASURE_CHAIN_THRESHOLD == 0 ? std::numeric_limits<size_t>::max() : RPP_TYPE_ERASURE_CHAIN_THRESHOLD;
+
+    // type-erased observable starts new chain of zero length
+    template<size_t Operators>
+    constexpr size_t expected_chain_length = Operators % erasure_period;
+} // namespace
+
+TEST_CASE("chain of operators is type-erased every RPP_TYPE_ERASURE_CHAIN_THRESHOLD operators")
+{
+    const auto source = rpp::source::create<int>([](const auto& observer) {
+        for (int v = 0; v < 5; ++v)
+            observer.on_next(v);
+        observer.on_completed();
+    });
+
+    const auto one = source | rpp::ops::map([](int v) { return v * 10; });
+    static_assert(chain_length_of<decltype(one)> == expected_chain_length<1>);
+
+    const auto two = one | rpp::ops::filter([](int v) { return v != 20; });
+    static_assert(chain_length_of<decltype(two)> == expected_chain_length<2>);
+
+    const auto three = two | rpp::ops::map([](int v) { return v + 1; });
+    static_assert(chain_length_of<decltype(three)> == expected_chain_length<3>);
+    static_assert(std::same_as<decltype(three), const rpp::dynamic_observable<int>> == (3 % erasure_period == 0));
+
+    const auto four = three | rpp::ops::map([](int v) { return std::to_string(v); });
+    static_assert(chain_length_of<decltype(four)> == expected_chain_length<4>);
+
+    auto mock = mock_observer_strategy<std::string>{};
+    four.subscribe(mock);
+
+    CHECK(mock.get_received_values() == std::vector<std::string>{"1", "11", "31", "41"});
+    CHECK(mock.get_on_completed_count() == 1);
+}
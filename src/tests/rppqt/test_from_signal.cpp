@@ -46,6 +46,9 @@ Q_SIGNALS:
 #include "mock_observer.hpp"
 #include "test_from_signal.moc"
 
+#include <QCoreApplication>
+#include <thread>
+
 TEST_CASE("from_signal can see object value from object signal")
 {
     SECTION("qobject with signal with 1 argument and observable from signal from this object")
@@ -134,4 +137,67 @@ TEST_CASE("from_signal sends special struct if no args in signal")
             }
         }
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("from_signal_coalesced emits latest value once per event loop iteration")
+{
+    int              argc{};
+    QCoreApplication application{argc, nullptr};
+
+    mock_observer_strategy<int> mock_observer{};
+    auto                        testobject = std::make_unique<TestQObject>();
+    rppqt::source::from_signal_coalesced(*testobject, &TestQObject::SingleValueSignal).subscribe(mock_observer);
+
+    testobject->EmitSingleValueSignal(1);
+    testobject->EmitSingleValueSignal(2);
+    std::thread{[&] { testobject->EmitSingleValueSignal(3); }}.join();
+
+    SECTION("emissions are not forwarded immediately")
+    {
+        CHECK(mock_observer.get_received_values().empty());
+    }
+
+    SECTION("latest value is emitted during event loop iteration")
+    {
+        QCoreApplication::processEvents();
+        CHECK(mock_observer.get_received_values() == std::vector<int>{3});
+
+        QCoreApplication::processEvents();
+        CHECK(mock_observer.get_received_values() == std::vector<int>{3});
+
+        testobject->EmitSingleValueSignal(4);
+        QCoreApplication::processEvents();
+        CHECK(mock_observer.get_received_values() == std::vector<int>{3, 4});
+    }
+
+    SECTION("pending value is dropped when object is destroyed")
+    {
+        testobject.reset();
+        CHECK(mock_observer.get_received_values().empty());
+        CHECK(mock_observer.get_on_completed_count() == 1);
+    }
+}
+
+TEST_CASE("from_signal_coalesced emits at most once per interval")
+{
+    int              argc{};
+    QCoreApplication application{argc, nullptr};
+
+    mock_observer_strategy<std::tuple<int, double, std::string>> mock_observer{};
+    auto                                                         testobject = std::make_unique<TestQObject>();
+    rppqt::source::from_signal_coalesced(*testobject, &TestQObject::MultipleValueSignal, std::chrono::milliseconds{50}).subscribe(mock_observer);
+
+    testobject->EmitMultipleValueSignal(1, 2, "first");
+    QCoreApplication::processEvents();
+    CHECK(mock_observer.get_received_values().size() == 1);
+
+    testobject->EmitMultipleValueSignal(2, 3, "second");
+    testobject->EmitMultipleValueSignal(3, 4, "third");
+    QCoreApplication::processEvents();
+    CHECK(mock_observer.get_received_values().size() == 1);
+
+    QTimer::singleShot(100, &application, [&] { application.exit(); });
+    application.exec();
+
+    CHECK(mock_observer.get_received_values() == std::vector<std::tuple<int, double, std::string>>{std::tuple{1, 2.0, "first"}, std::tuple{3, 4.0, "third"}});
+}
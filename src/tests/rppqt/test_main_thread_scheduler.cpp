@@ -17,6 +17,9 @@
 
 #include <QApplication>
 #include <future>
+#include <numeric>
+#include <thread>
+#include <vector>
 
 TEST_CASE("main_thread_scheduler schedules actions to main thread")
 {
@@ -69,3 +72,62 @@ TEST_CASE("main_thread_scheduler schedules actions to main thread")
         CHECK(execution == "outer inner outer inner ");
     }
 }
+
+TEST_CASE("main_thread_scheduler keeps order of schedulables")
+{
+    auto observer = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    int              argc{};
+    QCoreApplication application{argc, nullptr};
+    std::vector<int> order{};
+
+    SECTION("burst of schedulables from another thread")
+    {
+        std::thread{[&] {
+            const auto worker = rppqt::schedulers::main_thread_scheduler::create_worker();
+            for (int i = 0; i < 1000; ++i)
+            {
+                worker.schedule([&order, i](const auto&) -> rpp::schedulers::optional_delay_from_now {
+                    order.push_back(i);
+                    return {};
+                },
+                                observer);
+            }
+        }}.join();
+
+        QTimer::singleShot(10, &application, [&] { application.exit(); });
+        application.exec();
+
+        std::vector<int> expected(1000);
+        std::iota(expected.begin(), expected.end(), 0);
+        CHECK(order == expected);
+    }
+
+    SECTION("delayed schedulables are executed according to their time points")
+    {
+        const auto worker = rppqt::schedulers::main_thread_scheduler::create_worker();
+        const auto push   = [&order](int v) {
+            return [&order, v](const auto&) -> rpp::schedulers::optional_delay_from_now {
+                order.push_back(v);
+                return {};
+            };
+        };
+        const auto start = rpp::schedulers::clock_type::now();
+
+        worker.schedule(std::chrono::milliseconds{20}, push(3), observer);
+        worker.schedule(std::chrono::microseconds{1500}, push(1), observer);
+        worker.schedule(push(0), observer);
+        worker.schedule(std::chrono::milliseconds{10}, push(2), observer);
+        worker.schedule(std::chrono::milliseconds{20}, [&](const auto&) -> rpp::schedulers::optional_delay_from_now {
+            // delays are rounded up, so, schedulable is never executed earlier than requested
+            CHECK(rpp::schedulers::clock_type::now() - start >= std::chrono::milliseconds{20});
+            return {};
+        },
+                        observer);
+
+        QTimer::singleShot(50, &application, [&] { application.exit(); });
+        application.exec();
+
+        CHECK(order == std::vector{0, 1, 2, 3});
+    }
+}
@@ -0,0 +1,172 @@
+//                   ReactivePlusPlus library
+//
+//           Copyright Aleksey Loginov 2022 - present.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+//
+//  Project home: https://github.com/victimsnino/ReactivePlusPlus
+
+#include <snitch/snitch.hpp>
+
+#include <rpp/observers/dynamic_observer.hpp>
+#include <rpp/operators/as_blocking.hpp>
+#include <rpp/operators/observe_on.hpp>
+#include <rpp/operators/subscribe.hpp>
+#include <rpp/sources/from.hpp>
+
+#include <rppqt/schedulers/thread_pool.hpp>
+
+#include "mock_observer.hpp"
+
+#include <QThreadPool>
+#include <atomic>
+#include <future>
+#include <mutex>
+#include <numeric>
+#include <set>
+#include <thread>
+#include <vector>
+
+TEST_CASE("thread_pool_scheduler executes schedulables of worker serially on threads of pool")
+{
+    auto observer = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    QThreadPool pool{};
+    pool.setMaxThreadCount(2);
+
+    const auto scheduler = rppqt::schedulers::thread_pool_scheduler{&pool};
+
+    SECTION("schedulables of one worker are executed in order without overlapping")
+    {
+        constexpr int    count = 1000;
+        std::vector<int> execution{};
+        std::atomic_int  running{};
+        std::atomic_bool overlapped{};
+        std::atomic_bool on_main_thread{};
+        const auto       main_thread = std::this_thread::get_id();
+
+        {
+            auto worker = scheduler.create_worker();
+            for (int i = 0; i < count; ++i)
+            {
+                worker.schedule([&, i](const auto&) -> rpp::schedulers::optional_delay_from_now {
+                    if (running.fetch_add(1, std::memory_order::seq_cst) != 0)
+                        overlapped.store(true, std::memory_order::seq_cst);
+                    if (std::this_thread::get_id() == main_thread)
+                        on_main_thread.store(true, std::memory_order::seq_cst);
+                    execution.push_back(i);
+                    running.fetch_sub(1, std::memory_order::seq_cst);
+                    return {};
+                },
+                                observer);
+            }
+            pool.waitForDone();
+        }
+
+        std::vector<int> expected(count);
+        std::iota(expected.begin(), expected.end(), 0);
+        CHECK(execution == expected);
+        CHECK(!overlapped.load());
+        CHECK(!on_main_thread.load());
+    }
+
+    SECTION("workers share threads of pool")
+    {
+        std::mutex                mutex{};
+        std::set<std::thread::id> threads{};
+        std::atomic_int           executed{};
+
+        std::vector<decltype(scheduler.create_worker())> workers{};
+        for (int i = 0; i < 10; ++i)
+            workers.push_back(scheduler.create_worker());
+
+        for (const auto& worker : workers)
+        {
+            worker.schedule([&](const auto&) -> rpp::schedulers::optional_delay_from_now {
+                {
+                    std::lock_guard lock{mutex};
+                    threads.insert(std::this_thread::get_id());
+                }
+                executed.fetch_add(1, std::memory_order::seq_cst);
+                return {};
+            },
+                            observer);
+        }
+        pool.waitForDone();
+
+        CHECK(executed.load() == 10);
+        CHECK(threads.size() <= 2);
+    }
+
+    SECTION("recursive and delayed schedulables")
+    {
+        std::promise<std::vector<int>> result{};
+        std::vector<int>               execution{};
+
+        const auto worker = scheduler.create_worker();
+        const auto start  = rpp::schedulers::clock_type::now();
+        worker.schedule(std::chrono::milliseconds{10}, [&](const auto&) -> rpp::schedulers::optional_delay_from_now {
+            execution.push_back(static_cast<int>(execution.size()));
+            if (execution.size() < 3)
+                return rpp::schedulers::optional_delay_from_now{std::chrono::milliseconds{1}};
+
+            result.set_value(execution);
+            return {};
+        },
+                        observer);
+
+        auto future = result.get_future();
+        REQUIRE(future.wait_for(std::chrono::seconds{1}) == std::future_status::ready);
+        CHECK(future.get() == std::vector{0, 1, 2});
+        CHECK(rpp::schedulers::clock_type::now() - start >= std::chrono::milliseconds{12});
+    }
+
+    SECTION("disposed worker drops pending schedulables")
+    {
+        std::promise<void> started{};
+        std::promise<void> release{};
+        std::atomic_int    executed{};
+
+        auto worker = scheduler.create_worker();
+        worker.schedule([&](const auto&) -> rpp::schedulers::optional_delay_from_now {
+            started.set_value();
+            release.get_future().wait();
+            return {};
+        },
+                        observer);
+        worker.schedule([&](const auto&) -> rpp::schedulers::optional_delay_from_now {
+            executed.fetch_add(1, std::memory_order::seq_cst);
+            return {};
+        },
+                        observer);
+        worker.schedule(std::chrono::milliseconds{1}, [&](const auto&) -> rpp::schedulers::optional_delay_from_now {
+            executed.fetch_add(1, std::memory_order::seq_cst);
+            return {};
+        },
+                        observer);
+
+        started.get_future().wait();
+        worker.get_disposable().dispose();
+        release.set_value();
+        pool.waitForDone();
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+
+        CHECK(executed.load() == 0);
+    }
+}
+
+TEST_CASE("thread_pool_scheduler can be used with observe_on")
+{
+    QThreadPool pool{};
+    pool.setMaxThreadCount(2);
+
+    auto mock = mock_observer_strategy<int>{};
+    rpp::source::from_iterable(std::vector{1, 2, 3, 4, 5})
+        | rpp::ops::observe_on(rppqt::schedulers::thread_pool_scheduler{&pool})
+        | rpp::ops::as_blocking()
+        | rpp::ops::subscribe(mock);
+
+    CHECK(mock.get_received_values() == std::vector{1, 2, 3, 4, 5});
+    CHECK(mock.get_on_completed_count() == 1);
+}